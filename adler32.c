@@ -9,6 +9,11 @@
 
 #define local static
 
+#ifdef Z_X86_SIMD
+#  include <tmmintrin.h>
+#  include <immintrin.h>
+#endif
+
 local uLong adler32_combine_ OF((uLong adler1, uLong adler2, z_off64_t len2));
 
 #define BASE 65521      /* largest prime smaller than 65536 */
@@ -61,11 +66,46 @@ local uLong adler32_combine_ OF((uLong adler1, uLong adler2, z_off64_t len2));
 #  define MOD63(a) a %= BASE
 #endif
 
+#ifdef Z_X86_SIMD
+#  define BLOCK 32      /* bytes per SIMD step */
+#endif
+
 /* ========================================================================= */
 uLong ZEXPORT adler32(adler, buf, len)
     uLong adler;
     const Bytef *buf;
     uInt len;
+{
+    Z_KERNELS_INIT();
+    return z_kernels.adler32(adler, buf, len);
+}
+
+/* ========================================================================= */
+uLong ZLIB_INTERNAL copy_with_adler32(adler, dst, src, len)
+    uLong adler;
+    Bytef *dst;
+    const Bytef *src;
+    uInt len;
+{
+    uInt n;
+
+    Z_KERNELS_INIT();
+    while (len) {
+        n = len < Z_COPY_BLOCK ? len : Z_COPY_BLOCK;
+        zmemcpy(dst, src, n);
+        adler = z_kernels.adler32(adler, dst, n);
+        dst += n;
+        src += n;
+        len -= n;
+    }
+    return adler;
+}
+
+/* ========================================================================= */
+uLong ZLIB_INTERNAL adler32_generic(adler, buf, len)
+    uLong adler;
+    const Bytef *buf;
+    uInt len;
 {
     unsigned long sum2;
     unsigned n;
@@ -132,6 +172,144 @@ uLong ZEXPORT adler32(adler, buf, len)
     return adler | (sum2 << 16);
 }
 
+#ifdef Z_X86_SIMD
+
+/* =========================================================================
+ * Adler-32 with SSSE3, 32 bytes at a time.  Over n blocks the byte sum is the
+ * sum of all of the bytes, done with psadbw, and the sum of sums is 32 times
+ * the byte sums before each block, plus each byte weighted by its distance
+ * from the end of its block, done with pmaddubsw against the weights 32..1.
+ * At most NMAX / 32 blocks are done between reductions, so that no 32-bit
+ * lane can overflow.  Short buffers and the last len % 32 bytes are left to
+ * adler32_generic().
+ */
+uLong ZLIB_INTERNAL adler32_ssse3(adler, buf, len)
+    uLong adler;
+    const Bytef *buf;
+    uInt len;
+{
+    unsigned long s1, s2;
+    unsigned n, blocks;
+    __m128i tap1, tap2, zero, ones, v_ps, v_s1, v_s2, bytes1, bytes2;
+
+    if (buf == Z_NULL || len < 64)
+        return adler32_generic(adler, buf, len);
+    s1 = adler & 0xffff;
+    s2 = (adler >> 16) & 0xffff;
+    blocks = len / BLOCK;
+    len -= blocks * BLOCK;
+
+    tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,
+                         24, 23, 22, 21, 20, 19, 18, 17);
+    tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9,
+                         8, 7, 6, 5, 4, 3, 2, 1);
+    zero = _mm_setzero_si128();
+    ones = _mm_set1_epi16(1);
+
+    while (blocks) {
+        n = NMAX / BLOCK;
+        if (n > blocks)
+            n = blocks;
+        blocks -= n;
+
+        /* v_ps accumulates the byte sum before each block, starting with s1
+           for each of the n blocks */
+        v_ps = _mm_cvtsi32_si128((int)(s1 * n));
+        v_s2 = _mm_cvtsi32_si128((int)s2);
+        v_s1 = zero;
+        do {
+            bytes1 = _mm_loadu_si128((const __m128i *)buf);
+            bytes2 = _mm_loadu_si128((const __m128i *)(buf + 16));
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(
+                                 _mm_maddubs_epi16(bytes1, tap1), ones));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(
+                                 _mm_maddubs_epi16(bytes2, tap2), ones));
+            buf += BLOCK;
+        } while (--n);
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+        /* add up the lanes and reduce */
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, 0xb1));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, 0x4e));
+        s1 += (unsigned long)(unsigned)_mm_cvtsi128_si32(v_s1);
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, 0xb1));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, 0x4e));
+        s2 = (unsigned long)(unsigned)_mm_cvtsi128_si32(v_s2);
+        MOD(s1);
+        MOD(s2);
+    }
+    return adler32_generic(s1 | (s2 << 16), buf, len);
+}
+
+/* =========================================================================
+ * The same as adler32_ssse3(), but with each 32-byte block in one AVX2
+ * register.
+ */
+uLong ZLIB_INTERNAL adler32_avx2(adler, buf, len)
+    uLong adler;
+    const Bytef *buf;
+    uInt len;
+{
+    unsigned long s1, s2;
+    unsigned n, blocks;
+    __m256i tap, zero, ones, v_ps, v_s1, v_s2, bytes;
+    __m128i h1, h2;
+
+    if (buf == Z_NULL || len < 64)
+        return adler32_generic(adler, buf, len);
+    s1 = adler & 0xffff;
+    s2 = (adler >> 16) & 0xffff;
+    blocks = len / BLOCK;
+    len -= blocks * BLOCK;
+
+    tap = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,
+                           24, 23, 22, 21, 20, 19, 18, 17,
+                           16, 15, 14, 13, 12, 11, 10, 9,
+                           8, 7, 6, 5, 4, 3, 2, 1);
+    zero = _mm256_setzero_si256();
+    ones = _mm256_set1_epi16(1);
+
+    while (blocks) {
+        n = NMAX / BLOCK;
+        if (n > blocks)
+            n = blocks;
+        blocks -= n;
+
+        v_ps = _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, (int)(s1 * n));
+        v_s2 = _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, (int)s2);
+        v_s1 = zero;
+        do {
+            bytes = _mm256_loadu_si256((const __m256i *)buf);
+            v_ps = _mm256_add_epi32(v_ps, v_s1);
+            v_s1 = _mm256_add_epi32(v_s1, _mm256_sad_epu8(bytes, zero));
+            v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(
+                                    _mm256_maddubs_epi16(bytes, tap), ones));
+            buf += BLOCK;
+        } while (--n);
+        v_s2 = _mm256_add_epi32(v_s2, _mm256_slli_epi32(v_ps, 5));
+
+        /* add up the lanes and reduce */
+        h1 = _mm_add_epi32(_mm256_castsi256_si128(v_s1),
+                           _mm256_extracti128_si256(v_s1, 1));
+        h1 = _mm_add_epi32(h1, _mm_shuffle_epi32(h1, 0xb1));
+        h1 = _mm_add_epi32(h1, _mm_shuffle_epi32(h1, 0x4e));
+        s1 += (unsigned long)(unsigned)_mm_cvtsi128_si32(h1);
+        h2 = _mm_add_epi32(_mm256_castsi256_si128(v_s2),
+                           _mm256_extracti128_si256(v_s2, 1));
+        h2 = _mm_add_epi32(h2, _mm_shuffle_epi32(h2, 0xb1));
+        h2 = _mm_add_epi32(h2, _mm_shuffle_epi32(h2, 0x4e));
+        s2 = (unsigned long)(unsigned)_mm_cvtsi128_si32(h2);
+        MOD(s1);
+        MOD(s2);
+    }
+    return adler32_generic(s1 | (s2 << 16), buf, len);
+}
+
+#endif /* Z_X86_SIMD */
+
 /* ========================================================================= */
 local uLong adler32_combine_(adler1, adler2, len2)
     uLong adler1;
@@ -177,3 +355,31 @@ uLong ZEXPORT adler32_combine64(adler1, adler2, len2)
 {
     return adler32_combine_(adler1, adler2, len2);
 }
+
+/* ========================================================================= */
+uLong ZEXPORT adler32_iov(adler, iov, count)
+    uLong adler;
+    const z_iovec *iov;
+    unsigned count;
+{
+    if (iov == Z_NULL) return 1L;
+
+    Z_KERNELS_INIT();
+    return z_check_iov(z_kernels.adler32, adler, iov, count);
+}
+
+/* ========================================================================= */
+uLong ZEXPORT adler32_parallel(adler, buf, len, count, run, opaque)
+    uLong adler;
+    const Bytef *buf;
+    z_size_t len;
+    unsigned count;
+    z_run_func run;
+    voidpf opaque;
+{
+    if (buf == Z_NULL) return 1L;
+
+    Z_KERNELS_INIT();
+    return z_check_parallel(z_kernels.adler32, adler32_combine_, adler, 1L,
+                            buf, len, count, run, opaque);
+}
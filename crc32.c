@@ -12,11 +12,10 @@
 /* @(#) $Id$ */
 
 /*
-  Note on the use of DYNAMIC_CRC_TABLE: there is no mutex or semaphore
-  protection on the static variables used to control the first-use generation
-  of the crc tables.  Therefore, if you #define DYNAMIC_CRC_TABLE, you should
-  first call get_crc_table() to initialize the tables before allowing more than
-  one thread to use crc32().
+  Note on the use of DYNAMIC_CRC_TABLE: the crc tables are generated on first
+  use with Z_ONCE(), which is thread-safe where atomic operations are available
+  (see zutil.h).  Otherwise you should first call get_crc_table() to initialize
+  the tables before allowing more than one thread to use crc32().
 
   DYNAMIC_CRC_TABLE and MAKECRCH can be #defined to write out crc32.h.
  */
@@ -32,34 +31,64 @@
 
 #define local static
 
-/* Definitions for doing the crc four data bytes at a time. */
+#ifdef Z_X86_SIMD
+#  include <emmintrin.h>
+#  include <wmmintrin.h>
+#  include <nmmintrin.h>
+#endif
+
+/* Definitions for doing the crc eight data bytes at a time, as two words of
+   four bytes. */
 #if !defined(NOBYFOUR) && defined(Z_U4)
 #  define BYFOUR
 #endif
 #ifdef BYFOUR
    local unsigned long crc32_little OF((unsigned long,
-                        const unsigned char FAR *, unsigned));
+                        const unsigned char FAR *, unsigned,
+                        const z_crc_t FAR *));
    local unsigned long crc32_big OF((unsigned long,
-                        const unsigned char FAR *, unsigned));
-#  define TBLS 8
+                        const unsigned char FAR *, unsigned,
+                        const z_crc_t FAR *));
+#  define TBLS 16
 #else
 #  define TBLS 1
 #endif /* BYFOUR */
+local unsigned long crc_tables OF((unsigned long, const unsigned char FAR *,
+                                   unsigned, const z_crc_t FAR *));
+
+/* entry i of table k, of the TBLS tables of 256 starting at tab */
+#define TAB(k, i) tab[((k) << 8) + (i)]
+
+#ifdef Z_X86_SIMD
+   local unsigned long crc32_fold_pclmul OF((unsigned long,
+                        const unsigned char FAR *, unsigned))
+                        Z_TARGET("sse2,pclmul");
+#endif
 
 /* Local functions for crc concatenation */
-local unsigned long gf2_matrix_times OF((unsigned long *mat,
-                                         unsigned long vec));
-local void gf2_matrix_square OF((unsigned long *square, unsigned long *mat));
-local uLong crc32_combine_ OF((uLong crc1, uLong crc2, z_off64_t len2));
+#define POLY 0xedb88320UL       /* p(x) reflected, with x^32 implied */
+#define POLYC 0x82f63b78UL      /* Castagnoli's p(x) reflected, for crc32c */
+#define LANE 512                /* bytes in each lane of crc32c_sse42() */
+#define LANE_X2N 12             /* x^(8*LANE) is x^2^LANE_X2N */
+local z_crc_t multmodp OF((z_crc_t a, z_crc_t b, z_crc_t poly));
+local z_crc_t x2nmodp OF((z_off64_t n, unsigned k,
+                          const z_crc_t FAR *x2n, z_crc_t poly));
+local uLong crc32_merge OF((uLong crc1, uLong crc2, z_off64_t len2));
 
 
 #ifdef DYNAMIC_CRC_TABLE
 
-local volatile int crc_table_empty = 1;
+local z_once_t crc_table_made = Z_ONCE_INIT;
 local z_crc_t FAR crc_table[TBLS][256];
+local z_crc_t FAR x2n_table[32];
+local z_crc_t FAR crc32c_table[TBLS][256];
+local z_crc_t FAR crc32c_x2n_table[32];
+local z_crc_t FAR crc32c_shift_table[4][256];
 local void make_crc_table OF((void));
+local void make_tables OF((z_crc_t FAR *tab, z_crc_t FAR *x2n,
+                           z_crc_t poly));
 #ifdef MAKECRCH
-   local void write_table OF((FILE *, const z_crc_t FAR *));
+   local void write_table OF((FILE *, const z_crc_t FAR *, int));
 #endif /* MAKECRCH */
 /*
   Generate tables for a byte-wise 32-bit CRC calculation on the polynomial:
@@ -83,59 +112,42 @@ local void make_crc_table OF((void));
 
   The first table is simply the CRC of all possible eight bit values.  This is
   all the information needed to generate CRCs on data a byte at a time for all
-  combinations of CRC register values and incoming bytes.  The remaining tables
-  allow for word-at-a-time CRC calculation for both big-endian and little-
-  endian machines, where a word is four bytes.
+  combinations of CRC register values and incoming bytes.  The next seven
+  tables are the CRC of each value followed by one through seven zero bytes,
+  and the last eight are the byte reversals of the first eight.  These allow
+  for CRC calculation eight bytes (or four bytes) at a time on both little-
+  endian and big-endian machines, reading the data as four-byte words.
+
+  x2n_table[n] is x^2^n modulo p(x), in the same representation.  These are
+  multiplied together to get x^m for any m, which is what is needed to combine
+  CRCs.
+
+  crc32c_table and crc32c_x2n_table are the same for the Castagnoli
+  polynomial used by crc32c():
+  x^32+x^28+x^27+x^26+x^25+x^23+x^22+x^20+x^19+x^18+x^14+x^13+x^11+x^10+x^9+
+  x^8+x^6+1.  crc32c_shift_table multiplies a CRC-32C by x^(8*LANE), which
+  moves it past LANE zero bytes, by looking up each of its four bytes.
 */
 local void make_crc_table()
 {
-    z_crc_t c;
     int n, k;
     z_crc_t poly;                       /* polynomial exclusive-or pattern */
     /* terms of polynomial defining this crc (except x^32): */
-    static volatile int first = 1;      /* flag to limit concurrent making */
     static const unsigned char p[] = {0,1,2,4,5,7,8,10,11,12,16,22,23,26};
 
-    /* See if another task is already doing this (not thread-safe, but better
-       than nothing -- significantly reduces duration of vulnerability in
-       case the advice about DYNAMIC_CRC_TABLE is ignored) */
-    if (first) {
-        first = 0;
-
-        /* make exclusive-or pattern from polynomial (0xedb88320UL) */
-        poly = 0;
-        for (n = 0; n < (int)(sizeof(p)/sizeof(unsigned char)); n++)
-            poly |= (z_crc_t)1 << (31 - p[n]);
-
-        /* generate a crc for every 8-bit value */
-        for (n = 0; n < 256; n++) {
-            c = (z_crc_t)n;
-            for (k = 0; k < 8; k++)
-                c = c & 1 ? poly ^ (c >> 1) : c >> 1;
-            crc_table[0][n] = c;
-        }
+    /* this is only called once, through Z_ONCE() */
 
-#ifdef BYFOUR
-        /* generate crc for each value followed by one, two, and three zeros,
-           and then the byte reversal of those as well as the first table */
-        for (n = 0; n < 256; n++) {
-            c = crc_table[0][n];
-            crc_table[4][n] = ZSWAP32(c);
-            for (k = 1; k < 4; k++) {
-                c = crc_table[0][c & 0xff] ^ (c >> 8);
-                crc_table[k][n] = c;
-                crc_table[k + 4][n] = ZSWAP32(c);
-            }
-        }
-#endif /* BYFOUR */
+    /* make exclusive-or pattern from polynomial (0xedb88320UL) */
+    poly = 0;
+    for (n = 0; n < (int)(sizeof(p)/sizeof(unsigned char)); n++)
+        poly |= (z_crc_t)1 << (31 - p[n]);
 
-        crc_table_empty = 0;
-    }
-    else {      /* not first */
-        /* wait for the other guy to finish (not efficient, but rare) */
-        while (crc_table_empty)
-            ;
-    }
+    make_tables(crc_table[0], x2n_table, poly);
+    make_tables(crc32c_table[0], crc32c_x2n_table, POLYC);
+    for (k = 0; k < 4; k++)
+        for (n = 0; n < 256; n++)
+            crc32c_shift_table[k][n] = multmodp(crc32c_x2n_table[LANE_X2N],
+                                                (z_crc_t)n << (k << 3), POLYC);
 
 #ifdef MAKECRCH
     /* write out CRC tables to crc32.h */
@@ -148,38 +160,108 @@ local void make_crc_table()
         fprintf(out, " * Generated automatically by crc32.c\n */\n\n");
         fprintf(out, "local const z_crc_t FAR ");
         fprintf(out, "crc_table[TBLS][256] =\n{\n  {\n");
-        write_table(out, crc_table[0]);
+        write_table(out, crc_table[0], 256);
 #  ifdef BYFOUR
         fprintf(out, "#ifdef BYFOUR\n");
-        for (k = 1; k < 8; k++) {
+        for (k = 1; k < TBLS; k++) {
             fprintf(out, "  },\n  {\n");
-            write_table(out, crc_table[k]);
+            write_table(out, crc_table[k], 256);
         }
         fprintf(out, "#endif\n");
 #  endif /* BYFOUR */
         fprintf(out, "  }\n};\n");
+        fprintf(out, "\nlocal const z_crc_t FAR x2n_table[32] = {\n");
+        write_table(out, x2n_table, 32);
+        fprintf(out, "};\n");
+        fprintf(out, "\nlocal const z_crc_t FAR ");
+        fprintf(out, "crc32c_table[TBLS][256] =\n{\n  {\n");
+        write_table(out, crc32c_table[0], 256);
+#  ifdef BYFOUR
+        fprintf(out, "#ifdef BYFOUR\n");
+        for (k = 1; k < TBLS; k++) {
+            fprintf(out, "  },\n  {\n");
+            write_table(out, crc32c_table[k], 256);
+        }
+        fprintf(out, "#endif\n");
+#  endif /* BYFOUR */
+        fprintf(out, "  }\n};\n");
+        fprintf(out, "\nlocal const z_crc_t FAR crc32c_x2n_table[32] = {\n");
+        write_table(out, crc32c_x2n_table, 32);
+        fprintf(out, "};\n");
+        fprintf(out, "\n#ifdef Z_X86_SIMD\n");
+        fprintf(out, "local const z_crc_t FAR ");
+        fprintf(out, "crc32c_shift_table[4][256] =\n{\n  {\n");
+        write_table(out, crc32c_shift_table[0], 256);
+        for (k = 1; k < 4; k++) {
+            fprintf(out, "  },\n  {\n");
+            write_table(out, crc32c_shift_table[k], 256);
+        }
+        fprintf(out, "  }\n};\n#endif\n");
         fclose(out);
     }
 #endif /* MAKECRCH */
 }
 
+/* ===========================================================================
+ * Fill in the TBLS tables of 256 at tab, and the 32 powers at x2n, for the
+ * reflected polynomial poly.
+ */
+local void make_tables(tab, x2n, poly)
+    z_crc_t FAR *tab;
+    z_crc_t FAR *x2n;
+    z_crc_t poly;
+{
+    z_crc_t c;
+    int n, k;
+
+    /* generate a crc for every 8-bit value */
+    for (n = 0; n < 256; n++) {
+        c = (z_crc_t)n;
+        for (k = 0; k < 8; k++)
+            c = c & 1 ? poly ^ (c >> 1) : c >> 1;
+        TAB(0, n) = c;
+    }
+
+#ifdef BYFOUR
+    /* generate crc for each value followed by one to seven zeros, and then
+       the byte reversal of those as well as the first table */
+    for (n = 0; n < 256; n++) {
+        c = TAB(0, n);
+        TAB(8, n) = ZSWAP32(c);
+        for (k = 1; k < 8; k++) {
+            c = TAB(0, c & 0xff) ^ (c >> 8);
+            TAB(k, n) = c;
+            TAB(k + 8, n) = ZSWAP32(c);
+        }
+    }
+#endif /* BYFOUR */
+
+    /* generate x^2^n modulo p(x) for the combine functions */
+    c = (z_crc_t)1 << 30;               /* x^1 */
+    x2n[0] = c;
+    for (n = 1; n < 32; n++)
+        x2n[n] = c = multmodp(c, c, poly);
+}
+
 #ifdef MAKECRCH
-local void write_table(out, table)
+local void write_table(out, table, k)
     FILE *out;
     const z_crc_t FAR *table;
+    int k;
 {
     int n;
 
-    for (n = 0; n < 256; n++)
+    for (n = 0; n < k; n++)
         fprintf(out, "%s0x%08lxUL%s", n % 5 ? "" : "    ",
                 (unsigned long)(table[n]),
-                n == 255 ? "\n" : (n % 5 == 4 ? ",\n" : ", "));
+                n == k - 1 ? "\n" : (n % 5 == 4 ? ",\n" : ", "));
 }
 #endif /* MAKECRCH */
 
 #else /* !DYNAMIC_CRC_TABLE */
 /* ========================================================================
- * Tables of CRC-32s of all single-byte values, made by make_crc_table().
+ * Tables of CRC-32s and CRC-32Cs of all single-byte values, made by
+ * make_crc_table().
  */
 #include "crc32.h"
 #endif /* DYNAMIC_CRC_TABLE */
@@ -190,14 +272,13 @@ local void write_table(out, table)
 const z_crc_t FAR * ZEXPORT get_crc_table()
 {
 #ifdef DYNAMIC_CRC_TABLE
-    if (crc_table_empty)
-        make_crc_table();
+    Z_ONCE(&crc_table_made, make_crc_table);
 #endif /* DYNAMIC_CRC_TABLE */
     return (const z_crc_t FAR *)crc_table;
 }
 
 /* ========================================================================= */
-#define DO1 crc = crc_table[0][((int)crc ^ (*buf++)) & 0xff] ^ (crc >> 8)
+#define DO1 crc = TAB(0, ((int)crc ^ (*buf++)) & 0xff) ^ (crc >> 8)
 #define DO8 DO1; DO1; DO1; DO1; DO1; DO1; DO1; DO1
 
 /* ========================================================================= */
@@ -209,19 +290,93 @@ unsigned long ZEXPORT crc32(crc, buf, len)
     if (buf == Z_NULL) return 0UL;
 
 #ifdef DYNAMIC_CRC_TABLE
-    if (crc_table_empty)
-        make_crc_table();
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+
+    Z_KERNELS_INIT();
+    return z_kernels.crc32(crc, buf, len);
+}
+
+/* ========================================================================= */
+unsigned long ZEXPORT crc32c(crc, buf, len)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    uInt len;
+{
+    if (buf == Z_NULL) return 0UL;
+
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+
+    Z_KERNELS_INIT();
+    return z_kernels.crc32c(crc, buf, len);
+}
+
+/* ========================================================================= */
+uLong ZLIB_INTERNAL copy_with_crc32(crc, dst, src, len)
+    uLong crc;
+    Bytef *dst;
+    const Bytef *src;
+    uInt len;
+{
+    uInt n;
+
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
 #endif /* DYNAMIC_CRC_TABLE */
 
+    Z_KERNELS_INIT();
+    while (len) {
+        n = len < Z_COPY_BLOCK ? len : Z_COPY_BLOCK;
+        zmemcpy(dst, src, n);
+        crc = z_kernels.crc32(crc, dst, n);
+        dst += n;
+        src += n;
+        len -= n;
+    }
+    return crc;
+}
+
+/* =========================================================================
+ * The table-driven CRC, for any processor.  buf is not NULL, and the tables
+ * have been made.
+ */
+unsigned long ZLIB_INTERNAL crc32_generic(crc, buf, len)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    unsigned len;
+{
+    return crc_tables(crc, buf, len, crc_table[0]);
+}
+
+/* ========================================================================= */
+unsigned long ZLIB_INTERNAL crc32c_generic(crc, buf, len)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    unsigned len;
+{
+    return crc_tables(crc, buf, len, crc32c_table[0]);
+}
+
+/* =========================================================================
+ * Compute the CRC using the TBLS tables at tab, made for its polynomial.
+ */
+local unsigned long crc_tables(crc, buf, len, tab)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    unsigned len;
+    const z_crc_t FAR *tab;
+{
 #ifdef BYFOUR
     if (sizeof(void *) == sizeof(ptrdiff_t)) {
         z_crc_t endian;
 
         endian = 1;
         if (*((unsigned char *)(&endian)))
-            return crc32_little(crc, buf, len);
+            return crc32_little(crc, buf, len, tab);
         else
-            return crc32_big(crc, buf, len);
+            return crc32_big(crc, buf, len, tab);
     }
 #endif /* BYFOUR */
     crc = crc ^ 0xffffffffUL;
@@ -235,27 +390,56 @@ unsigned long ZEXPORT crc32(crc, buf, len)
     return crc ^ 0xffffffffUL;
 }
 
+#ifdef Z_X86_SIMD
+/* =========================================================================
+ * Fold all but the last len % 16 bytes with carry-less multiplies, and finish
+ * up with the tables.  Short buffers go straight to the tables.
+ */
+unsigned long ZLIB_INTERNAL crc32_pclmul(crc, buf, len)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    unsigned len;
+{
+    if (len >= 64) {
+        unsigned n = len & ~15U;
+
+        crc = crc32_fold_pclmul(crc, buf, n);
+        buf += n;
+        len -= n;
+        if (len == 0)
+            return crc;
+    }
+    return crc32_generic(crc, buf, len);
+}
+#endif /* Z_X86_SIMD */
+
 #ifdef BYFOUR
 
 /* ========================================================================= */
 #define DOLIT4 c ^= *buf4++; \
-        c = crc_table[3][c & 0xff] ^ crc_table[2][(c >> 8) & 0xff] ^ \
-            crc_table[1][(c >> 16) & 0xff] ^ crc_table[0][c >> 24]
-#define DOLIT32 DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4
+        c = TAB(3, c & 0xff) ^ TAB(2, (c >> 8) & 0xff) ^ \
+            TAB(1, (c >> 16) & 0xff) ^ TAB(0, c >> 24)
+#define DOLIT8 one = *buf4++ ^ c; two = *buf4++; \
+        c = TAB(7, one & 0xff) ^ TAB(6, (one >> 8) & 0xff) ^ \
+            TAB(5, (one >> 16) & 0xff) ^ TAB(4, one >> 24) ^ \
+            TAB(3, two & 0xff) ^ TAB(2, (two >> 8) & 0xff) ^ \
+            TAB(1, (two >> 16) & 0xff) ^ TAB(0, two >> 24)
+#define DOLIT32 DOLIT8; DOLIT8; DOLIT8; DOLIT8
 
 /* ========================================================================= */
-local unsigned long crc32_little(crc, buf, len)
+local unsigned long crc32_little(crc, buf, len, tab)
     unsigned long crc;
     const unsigned char FAR *buf;
     unsigned len;
+    const z_crc_t FAR *tab;
 {
-    register z_crc_t c;
+    register z_crc_t c, one, two;
     register const z_crc_t FAR *buf4;
 
     c = (z_crc_t)crc;
     c = ~c;
     while (len && ((ptrdiff_t)buf & 3)) {
-        c = crc_table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
+        c = TAB(0, (c ^ *buf++) & 0xff) ^ (c >> 8);
         len--;
     }
 
@@ -264,14 +448,18 @@ local unsigned long crc32_little(crc, buf, len)
         DOLIT32;
         len -= 32;
     }
-    while (len >= 4) {
+    while (len >= 8) {
+        DOLIT8;
+        len -= 8;
+    }
+    if (len >= 4) {
         DOLIT4;
         len -= 4;
     }
     buf = (const unsigned char FAR *)buf4;
 
     if (len) do {
-        c = crc_table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
+        c = TAB(0, (c ^ *buf++) & 0xff) ^ (c >> 8);
     } while (--len);
     c = ~c;
     return (unsigned long)c;
@@ -279,23 +467,29 @@ local unsigned long crc32_little(crc, buf, len)
 
 /* ========================================================================= */
 #define DOBIG4 c ^= *++buf4; \
-        c = crc_table[4][c & 0xff] ^ crc_table[5][(c >> 8) & 0xff] ^ \
-            crc_table[6][(c >> 16) & 0xff] ^ crc_table[7][c >> 24]
-#define DOBIG32 DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4
+        c = TAB(8, c & 0xff) ^ TAB(9, (c >> 8) & 0xff) ^ \
+            TAB(10, (c >> 16) & 0xff) ^ TAB(11, c >> 24)
+#define DOBIG8 one = *++buf4 ^ c; two = *++buf4; \
+        c = TAB(12, one & 0xff) ^ TAB(13, (one >> 8) & 0xff) ^ \
+            TAB(14, (one >> 16) & 0xff) ^ TAB(15, one >> 24) ^ \
+            TAB(8, two & 0xff) ^ TAB(9, (two >> 8) & 0xff) ^ \
+            TAB(10, (two >> 16) & 0xff) ^ TAB(11, two >> 24)
+#define DOBIG32 DOBIG8; DOBIG8; DOBIG8; DOBIG8
 
 /* ========================================================================= */
-local unsigned long crc32_big(crc, buf, len)
+local unsigned long crc32_big(crc, buf, len, tab)
     unsigned long crc;
     const unsigned char FAR *buf;
     unsigned len;
+    const z_crc_t FAR *tab;
 {
-    register z_crc_t c;
+    register z_crc_t c, one, two;
     register const z_crc_t FAR *buf4;
 
     c = ZSWAP32((z_crc_t)crc);
     c = ~c;
     while (len && ((ptrdiff_t)buf & 3)) {
-        c = crc_table[4][(c >> 24) ^ *buf++] ^ (c << 8);
+        c = TAB(8, (c >> 24) ^ *buf++) ^ (c << 8);
         len--;
     }
 
@@ -305,7 +499,11 @@ local unsigned long crc32_big(crc, buf, len)
         DOBIG32;
         len -= 32;
     }
-    while (len >= 4) {
+    while (len >= 8) {
+        DOBIG8;
+        len -= 8;
+    }
+    if (len >= 4) {
         DOBIG4;
         len -= 4;
     }
@@ -313,7 +511,7 @@ local unsigned long crc32_big(crc, buf, len)
     buf = (const unsigned char FAR *)buf4;
 
     if (len) do {
-        c = crc_table[4][(c >> 24) ^ *buf++] ^ (c << 8);
+        c = TAB(8, (c >> 24) ^ *buf++) ^ (c << 8);
     } while (--len);
     c = ~c;
     return (unsigned long)(ZSWAP32(c));
@@ -321,105 +519,353 @@ local unsigned long crc32_big(crc, buf, len)
 
 #endif /* BYFOUR */
 
-#define GF2_DIM 32      /* dimension of GF(2) vectors (length of CRC) */
+#ifdef Z_X86_SIMD
 
-/* ========================================================================= */
-local unsigned long gf2_matrix_times(mat, vec)
-    unsigned long *mat;
-    unsigned long vec;
+/* =========================================================================
+ * CRC-32 with carry-less multiplication, following "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ Instruction" (V. Gopal et al., Intel,
+ * 2009).  Four 128-bit lanes of data are folded forward 64 bytes at a time,
+ * then folded into a single lane, which is folded 16 bytes at a time over
+ * what remains.  The last 128 bits are reduced to 64 and then to the 32-bit
+ * CRC with a Barrett reduction.  The constants are the bit-reflected
+ * remainders x^(n-1) mod p for each folding distance n, plus the reflected
+ * polynomial and its Barrett quotient.  len must be a multiple of 16 that is
+ * at least 64.
+ */
+local unsigned long crc32_fold_pclmul(crc, buf, len)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    unsigned len;
 {
-    unsigned long sum;
-
-    sum = 0;
-    while (vec) {
-        if (vec & 1)
-            sum ^= *mat;
-        vec >>= 1;
-        mat++;
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+    __m128i k1k2, k3k4, k5, poly, mask32;
+
+    /* x^(4*128+32) and x^(4*128-32) mod p: fold across 64 bytes */
+    k1k2 = _mm_set_epi32(0x00000001, (int)0xc6e41596UL,
+                         0x00000001, (int)0x54442bd4UL);
+    /* x^(128+32) and x^(128-32) mod p: fold across 16 bytes */
+    k3k4 = _mm_set_epi32(0x00000000, (int)0xccaa009eUL,
+                         0x00000001, (int)0x751997d0UL);
+    /* x^64 mod p: fold 96 bits down to 64 */
+    k5 = _mm_set_epi32(0, 0, 0x00000001, (int)0x63cd6124UL);
+    /* reflected p (low) and floor(x^64 / p) reflected (high) for Barrett */
+    poly = _mm_set_epi32(0x00000001, (int)0xf7011641UL,
+                         0x00000001, (int)0xdb710641UL);
+    mask32 = _mm_set_epi32(0, ~0, 0, ~0);
+
+    /* load the first 64 bytes, with the pre-conditioned crc in the first */
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)(~crc & 0xffffffffUL)));
+    buf += 64;
+    len -= 64;
+
+    /* fold four lanes at a time over the bulk of the data */
+    x0 = k1k2;
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        buf += 64;
+        len -= 64;
+    }
+
+    /* fold the four lanes into one */
+    x0 = k3k4;
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* fold in the remaining 16-byte blocks one at a time */
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *)buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        buf += 16;
+        len -= 16;
     }
-    return sum;
+
+    /* fold 128 bits to 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduction from 64 bits to 32 bits */
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* the crc is in the second 32-bit word -- post-condition and return it */
+    crc = (unsigned long)(unsigned)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+    return crc ^ 0xffffffffUL;
+}
+
+/* =========================================================================
+ * CRC-32C with the SSE4.2 crc32 instruction.  Each crc32 instruction has to
+ * wait for the one before it to finish, but three can be in flight at once,
+ * so long runs are split into three lanes of LANE bytes whose CRCs are
+ * computed side by side.  Then the CRC of the first lane is moved past the
+ * second with crc32c_shift_table[] and the second's CRC added in, and the
+ * same again for the third.
+ */
+#define SHIFT(c) (crc32c_shift_table[0][(c) & 0xff] ^ \
+                  crc32c_shift_table[1][((c) >> 8) & 0xff] ^ \
+                  crc32c_shift_table[2][((c) >> 16) & 0xff] ^ \
+                  crc32c_shift_table[3][(c) >> 24])
+#if defined(__x86_64__) || defined(_M_X64)
+#  define WORD 8
+#  define CRCW(c, p) (z_crc_t)_mm_crc32_u64(c, \
+                        *(const unsigned long long FAR *)(const void FAR *)(p))
+#else
+#  define WORD 4
+#  define CRCW(c, p) (z_crc_t)_mm_crc32_u32(c, \
+                        *(const unsigned FAR *)(const void FAR *)(p))
+#endif
+
+unsigned long ZLIB_INTERNAL crc32c_sse42(crc, buf, len)
+    unsigned long crc;
+    const unsigned char FAR *buf;
+    unsigned len;
+{
+    z_crc_t c0, c1, c2;
+    unsigned n;
+
+    c0 = ~(z_crc_t)crc;
+    while (len && ((ptrdiff_t)buf & (WORD - 1))) {
+        c0 = _mm_crc32_u8(c0, *buf++);
+        len--;
+    }
+
+    /* three lanes at a time */
+    while (len >= 3 * LANE) {
+        c1 = c2 = 0;
+        for (n = 0; n < LANE; n += WORD) {
+            c0 = CRCW(c0, buf + n);
+            c1 = CRCW(c1, buf + LANE + n);
+            c2 = CRCW(c2, buf + 2 * LANE + n);
+        }
+        c0 = SHIFT(c0) ^ c1;
+        c0 = SHIFT(c0) ^ c2;
+        buf += 3 * LANE;
+        len -= 3 * LANE;
+    }
+
+    /* then a word at a time, and a byte at a time */
+    while (len >= WORD) {
+        c0 = CRCW(c0, buf);
+        buf += WORD;
+        len -= WORD;
+    }
+    while (len) {
+        c0 = _mm_crc32_u8(c0, *buf++);
+        len--;
+    }
+    return (unsigned long)(z_crc_t)~c0;
+}
+
+#endif /* Z_X86_SIMD */
+
+/* =========================================================================
+ * Return a(x) multiplied by b(x) modulo p(x), where p(x) is the CRC polynomial,
+ * given reflected in poly.  For speed, this requires that a not be zero.
+ */
+local z_crc_t multmodp(a, b, poly)
+    z_crc_t a;
+    z_crc_t b;
+    z_crc_t poly;
+{
+    z_crc_t m, p;
+
+    m = (z_crc_t)1 << 31;
+    p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+
+/* =========================================================================
+ * Return x^(n * 2^k) modulo p(x), using at most one multiplication for each
+ * bit of n.  x2n is the table of x^2^n modulo p(x), which has been made.
+ */
+local z_crc_t x2nmodp(n, k, x2n, poly)
+    z_off64_t n;
+    unsigned k;
+    const z_crc_t FAR *x2n;
+    z_crc_t poly;
+{
+    z_crc_t p;
+
+    p = (z_crc_t)1 << 31;               /* x^0 == 1 */
+    while (n) {
+        if (n & 1)
+            p = multmodp(x2n[k & 31], p, poly);
+        n >>= 1;
+        k++;
+    }
+    return p;
 }
 
 /* ========================================================================= */
-local void gf2_matrix_square(square, mat)
-    unsigned long *square;
-    unsigned long *mat;
+uLong ZEXPORT crc32_combine64(crc1, crc2, len2)
+    uLong crc1;
+    uLong crc2;
+    z_off64_t len2;
 {
-    int n;
+    /* degenerate case (also disallow negative lengths) */
+    if (len2 <= 0)
+        return crc1;
 
-    for (n = 0; n < GF2_DIM; n++)
-        square[n] = gf2_matrix_times(mat, mat[n]);
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+    return multmodp(x2nmodp(len2, 3, x2n_table, POLY), (z_crc_t)crc1, POLY) ^
+           (crc2 & 0xffffffffUL);
 }
 
 /* ========================================================================= */
-local uLong crc32_combine_(crc1, crc2, len2)
+uLong ZEXPORT crc32_combine(crc1, crc2, len2)
     uLong crc1;
     uLong crc2;
+    z_off_t len2;
+{
+    return crc32_combine64(crc1, crc2, len2);
+}
+
+/* ========================================================================= */
+uLong ZEXPORT crc32_combine_gen64(len2)
     z_off64_t len2;
 {
-    int n;
-    unsigned long row;
-    unsigned long even[GF2_DIM];    /* even-power-of-two zeros operator */
-    unsigned long odd[GF2_DIM];     /* odd-power-of-two zeros operator */
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+    return len2 <= 0 ? (z_crc_t)1 << 31 : x2nmodp(len2, 3, x2n_table, POLY);
+}
 
+/* ========================================================================= */
+uLong ZEXPORT crc32_combine_gen(len2)
+    z_off_t len2;
+{
+    return crc32_combine_gen64(len2);
+}
+
+/* ========================================================================= */
+uLong ZEXPORT crc32_combine_op(crc1, crc2, op)
+    uLong crc1;
+    uLong crc2;
+    uLong op;
+{
+    if ((op & 0xffffffffUL) == 0)       /* not a valid operator */
+        return crc2;
+    return multmodp((z_crc_t)op, (z_crc_t)crc1, POLY) ^ (crc2 & 0xffffffffUL);
+}
+
+/* ========================================================================= */
+uLong ZEXPORT crc32c_combine64(crc1, crc2, len2)
+    uLong crc1;
+    uLong crc2;
+    z_off64_t len2;
+{
     /* degenerate case (also disallow negative lengths) */
     if (len2 <= 0)
         return crc1;
 
-    /* put operator for one zero bit in odd */
-    odd[0] = 0xedb88320UL;          /* CRC-32 polynomial */
-    row = 1;
-    for (n = 1; n < GF2_DIM; n++) {
-        odd[n] = row;
-        row <<= 1;
-    }
-
-    /* put operator for two zero bits in even */
-    gf2_matrix_square(even, odd);
-
-    /* put operator for four zero bits in odd */
-    gf2_matrix_square(odd, even);
-
-    /* apply len2 zeros to crc1 (first square will put the operator for one
-       zero byte, eight zero bits, in even) */
-    do {
-        /* apply zeros operator for this bit of len2 */
-        gf2_matrix_square(even, odd);
-        if (len2 & 1)
-            crc1 = gf2_matrix_times(even, crc1);
-        len2 >>= 1;
-
-        /* if no more bits set, then done */
-        if (len2 == 0)
-            break;
-
-        /* another iteration of the loop with odd and even swapped */
-        gf2_matrix_square(odd, even);
-        if (len2 & 1)
-            crc1 = gf2_matrix_times(odd, crc1);
-        len2 >>= 1;
-
-        /* if no more bits set, then done */
-    } while (len2 != 0);
-
-    /* return combined crc */
-    crc1 ^= crc2;
-    return crc1;
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+    return multmodp(x2nmodp(len2, 3, crc32c_x2n_table, POLYC), (z_crc_t)crc1,
+                    POLYC) ^ (crc2 & 0xffffffffUL);
 }
 
 /* ========================================================================= */
-uLong ZEXPORT crc32_combine(crc1, crc2, len2)
+uLong ZEXPORT crc32c_combine(crc1, crc2, len2)
     uLong crc1;
     uLong crc2;
     z_off_t len2;
 {
-    return crc32_combine_(crc1, crc2, len2);
+    return crc32c_combine64(crc1, crc2, len2);
 }
 
-uLong ZEXPORT crc32_combine64(crc1, crc2, len2)
+/* ========================================================================= */
+uLong ZEXPORT crc32_iov(crc, iov, count)
+    uLong crc;
+    const z_iovec *iov;
+    unsigned count;
+{
+    if (iov == Z_NULL) return 0UL;
+
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+
+    Z_KERNELS_INIT();
+    return z_check_iov(z_kernels.crc32, crc, iov, count);
+}
+
+/* ========================================================================= */
+local uLong crc32_merge(crc1, crc2, len2)
     uLong crc1;
     uLong crc2;
     z_off64_t len2;
 {
-    return crc32_combine_(crc1, crc2, len2);
+    return crc32_combine64(crc1, crc2, len2);
+}
+
+/* ========================================================================= */
+uLong ZEXPORT crc32_parallel(crc, buf, len, count, run, opaque)
+    uLong crc;
+    const Bytef *buf;
+    z_size_t len;
+    unsigned count;
+    z_run_func run;
+    voidpf opaque;
+{
+    if (buf == Z_NULL) return 0UL;
+
+#ifdef DYNAMIC_CRC_TABLE
+    Z_ONCE(&crc_table_made, make_crc_table);
+#endif /* DYNAMIC_CRC_TABLE */
+
+    Z_KERNELS_INIT();
+    return z_check_parallel(z_kernels.crc32, crc32_merge, crc, 0UL, buf, len,
+                            count, run, opaque);
 }
@@ -221,6 +221,222 @@ local const z_crc_t FAR crc_table[TBLS][256] =
     0xe9dbf6c3UL, 0x516791a6UL, 0xccb0a91fUL, 0x740cce7aUL, 0x66b96194UL,
     0xde0506f1UL
   },
+  {
+    0x00000000UL, 0x3d6029b0UL, 0x7ac05360UL, 0x47a07ad0UL, 0xf580a6c0UL,
+    0xc8e08f70UL, 0x8f40f5a0UL, 0xb220dc10UL, 0x30704bc1UL, 0x0d106271UL,
+    0x4ab018a1UL, 0x77d03111UL, 0xc5f0ed01UL, 0xf890c4b1UL, 0xbf30be61UL,
+    0x825097d1UL, 0x60e09782UL, 0x5d80be32UL, 0x1a20c4e2UL, 0x2740ed52UL,
+    0x95603142UL, 0xa80018f2UL, 0xefa06222UL, 0xd2c04b92UL, 0x5090dc43UL,
+    0x6df0f5f3UL, 0x2a508f23UL, 0x1730a693UL, 0xa5107a83UL, 0x98705333UL,
+    0xdfd029e3UL, 0xe2b00053UL, 0xc1c12f04UL, 0xfca106b4UL, 0xbb017c64UL,
+    0x866155d4UL, 0x344189c4UL, 0x0921a074UL, 0x4e81daa4UL, 0x73e1f314UL,
+    0xf1b164c5UL, 0xccd14d75UL, 0x8b7137a5UL, 0xb6111e15UL, 0x0431c205UL,
+    0x3951ebb5UL, 0x7ef19165UL, 0x4391b8d5UL, 0xa121b886UL, 0x9c419136UL,
+    0xdbe1ebe6UL, 0xe681c256UL, 0x54a11e46UL, 0x69c137f6UL, 0x2e614d26UL,
+    0x13016496UL, 0x9151f347UL, 0xac31daf7UL, 0xeb91a027UL, 0xd6f18997UL,
+    0x64d15587UL, 0x59b17c37UL, 0x1e1106e7UL, 0x23712f57UL, 0x58f35849UL,
+    0x659371f9UL, 0x22330b29UL, 0x1f532299UL, 0xad73fe89UL, 0x9013d739UL,
+    0xd7b3ade9UL, 0xead38459UL, 0x68831388UL, 0x55e33a38UL, 0x124340e8UL,
+    0x2f236958UL, 0x9d03b548UL, 0xa0639cf8UL, 0xe7c3e628UL, 0xdaa3cf98UL,
+    0x3813cfcbUL, 0x0573e67bUL, 0x42d39cabUL, 0x7fb3b51bUL, 0xcd93690bUL,
+    0xf0f340bbUL, 0xb7533a6bUL, 0x8a3313dbUL, 0x0863840aUL, 0x3503adbaUL,
+    0x72a3d76aUL, 0x4fc3fedaUL, 0xfde322caUL, 0xc0830b7aUL, 0x872371aaUL,
+    0xba43581aUL, 0x9932774dUL, 0xa4525efdUL, 0xe3f2242dUL, 0xde920d9dUL,
+    0x6cb2d18dUL, 0x51d2f83dUL, 0x167282edUL, 0x2b12ab5dUL, 0xa9423c8cUL,
+    0x9422153cUL, 0xd3826fecUL, 0xeee2465cUL, 0x5cc29a4cUL, 0x61a2b3fcUL,
+    0x2602c92cUL, 0x1b62e09cUL, 0xf9d2e0cfUL, 0xc4b2c97fUL, 0x8312b3afUL,
+    0xbe729a1fUL, 0x0c52460fUL, 0x31326fbfUL, 0x7692156fUL, 0x4bf23cdfUL,
+    0xc9a2ab0eUL, 0xf4c282beUL, 0xb362f86eUL, 0x8e02d1deUL, 0x3c220dceUL,
+    0x0142247eUL, 0x46e25eaeUL, 0x7b82771eUL, 0xb1e6b092UL, 0x8c869922UL,
+    0xcb26e3f2UL, 0xf646ca42UL, 0x44661652UL, 0x79063fe2UL, 0x3ea64532UL,
+    0x03c66c82UL, 0x8196fb53UL, 0xbcf6d2e3UL, 0xfb56a833UL, 0xc6368183UL,
+    0x74165d93UL, 0x49767423UL, 0x0ed60ef3UL, 0x33b62743UL, 0xd1062710UL,
+    0xec660ea0UL, 0xabc67470UL, 0x96a65dc0UL, 0x248681d0UL, 0x19e6a860UL,
+    0x5e46d2b0UL, 0x6326fb00UL, 0xe1766cd1UL, 0xdc164561UL, 0x9bb63fb1UL,
+    0xa6d61601UL, 0x14f6ca11UL, 0x2996e3a1UL, 0x6e369971UL, 0x5356b0c1UL,
+    0x70279f96UL, 0x4d47b626UL, 0x0ae7ccf6UL, 0x3787e546UL, 0x85a73956UL,
+    0xb8c710e6UL, 0xff676a36UL, 0xc2074386UL, 0x4057d457UL, 0x7d37fde7UL,
+    0x3a978737UL, 0x07f7ae87UL, 0xb5d77297UL, 0x88b75b27UL, 0xcf1721f7UL,
+    0xf2770847UL, 0x10c70814UL, 0x2da721a4UL, 0x6a075b74UL, 0x576772c4UL,
+    0xe547aed4UL, 0xd8278764UL, 0x9f87fdb4UL, 0xa2e7d404UL, 0x20b743d5UL,
+    0x1dd76a65UL, 0x5a7710b5UL, 0x67173905UL, 0xd537e515UL, 0xe857cca5UL,
+    0xaff7b675UL, 0x92979fc5UL, 0xe915e8dbUL, 0xd475c16bUL, 0x93d5bbbbUL,
+    0xaeb5920bUL, 0x1c954e1bUL, 0x21f567abUL, 0x66551d7bUL, 0x5b3534cbUL,
+    0xd965a31aUL, 0xe4058aaaUL, 0xa3a5f07aUL, 0x9ec5d9caUL, 0x2ce505daUL,
+    0x11852c6aUL, 0x562556baUL, 0x6b457f0aUL, 0x89f57f59UL, 0xb49556e9UL,
+    0xf3352c39UL, 0xce550589UL, 0x7c75d999UL, 0x4115f029UL, 0x06b58af9UL,
+    0x3bd5a349UL, 0xb9853498UL, 0x84e51d28UL, 0xc34567f8UL, 0xfe254e48UL,
+    0x4c059258UL, 0x7165bbe8UL, 0x36c5c138UL, 0x0ba5e888UL, 0x28d4c7dfUL,
+    0x15b4ee6fUL, 0x521494bfUL, 0x6f74bd0fUL, 0xdd54611fUL, 0xe03448afUL,
+    0xa794327fUL, 0x9af41bcfUL, 0x18a48c1eUL, 0x25c4a5aeUL, 0x6264df7eUL,
+    0x5f04f6ceUL, 0xed242adeUL, 0xd044036eUL, 0x97e479beUL, 0xaa84500eUL,
+    0x4834505dUL, 0x755479edUL, 0x32f4033dUL, 0x0f942a8dUL, 0xbdb4f69dUL,
+    0x80d4df2dUL, 0xc774a5fdUL, 0xfa148c4dUL, 0x78441b9cUL, 0x4524322cUL,
+    0x028448fcUL, 0x3fe4614cUL, 0x8dc4bd5cUL, 0xb0a494ecUL, 0xf704ee3cUL,
+    0xca64c78cUL
+  },
+  {
+    0x00000000UL, 0xcb5cd3a5UL, 0x4dc8a10bUL, 0x869472aeUL, 0x9b914216UL,
+    0x50cd91b3UL, 0xd659e31dUL, 0x1d0530b8UL, 0xec53826dUL, 0x270f51c8UL,
+    0xa19b2366UL, 0x6ac7f0c3UL, 0x77c2c07bUL, 0xbc9e13deUL, 0x3a0a6170UL,
+    0xf156b2d5UL, 0x03d6029bUL, 0xc88ad13eUL, 0x4e1ea390UL, 0x85427035UL,
+    0x9847408dUL, 0x531b9328UL, 0xd58fe186UL, 0x1ed33223UL, 0xef8580f6UL,
+    0x24d95353UL, 0xa24d21fdUL, 0x6911f258UL, 0x7414c2e0UL, 0xbf481145UL,
+    0x39dc63ebUL, 0xf280b04eUL, 0x07ac0536UL, 0xccf0d693UL, 0x4a64a43dUL,
+    0x81387798UL, 0x9c3d4720UL, 0x57619485UL, 0xd1f5e62bUL, 0x1aa9358eUL,
+    0xebff875bUL, 0x20a354feUL, 0xa6372650UL, 0x6d6bf5f5UL, 0x706ec54dUL,
+    0xbb3216e8UL, 0x3da66446UL, 0xf6fab7e3UL, 0x047a07adUL, 0xcf26d408UL,
+    0x49b2a6a6UL, 0x82ee7503UL, 0x9feb45bbUL, 0x54b7961eUL, 0xd223e4b0UL,
+    0x197f3715UL, 0xe82985c0UL, 0x23755665UL, 0xa5e124cbUL, 0x6ebdf76eUL,
+    0x73b8c7d6UL, 0xb8e41473UL, 0x3e7066ddUL, 0xf52cb578UL, 0x0f580a6cUL,
+    0xc404d9c9UL, 0x4290ab67UL, 0x89cc78c2UL, 0x94c9487aUL, 0x5f959bdfUL,
+    0xd901e971UL, 0x125d3ad4UL, 0xe30b8801UL, 0x28575ba4UL, 0xaec3290aUL,
+    0x659ffaafUL, 0x789aca17UL, 0xb3c619b2UL, 0x35526b1cUL, 0xfe0eb8b9UL,
+    0x0c8e08f7UL, 0xc7d2db52UL, 0x4146a9fcUL, 0x8a1a7a59UL, 0x971f4ae1UL,
+    0x5c439944UL, 0xdad7ebeaUL, 0x118b384fUL, 0xe0dd8a9aUL, 0x2b81593fUL,
+    0xad152b91UL, 0x6649f834UL, 0x7b4cc88cUL, 0xb0101b29UL, 0x36846987UL,
+    0xfdd8ba22UL, 0x08f40f5aUL, 0xc3a8dcffUL, 0x453cae51UL, 0x8e607df4UL,
+    0x93654d4cUL, 0x58399ee9UL, 0xdeadec47UL, 0x15f13fe2UL, 0xe4a78d37UL,
+    0x2ffb5e92UL, 0xa96f2c3cUL, 0x6233ff99UL, 0x7f36cf21UL, 0xb46a1c84UL,
+    0x32fe6e2aUL, 0xf9a2bd8fUL, 0x0b220dc1UL, 0xc07ede64UL, 0x46eaaccaUL,
+    0x8db67f6fUL, 0x90b34fd7UL, 0x5bef9c72UL, 0xdd7beedcUL, 0x16273d79UL,
+    0xe7718facUL, 0x2c2d5c09UL, 0xaab92ea7UL, 0x61e5fd02UL, 0x7ce0cdbaUL,
+    0xb7bc1e1fUL, 0x31286cb1UL, 0xfa74bf14UL, 0x1eb014d8UL, 0xd5ecc77dUL,
+    0x5378b5d3UL, 0x98246676UL, 0x852156ceUL, 0x4e7d856bUL, 0xc8e9f7c5UL,
+    0x03b52460UL, 0xf2e396b5UL, 0x39bf4510UL, 0xbf2b37beUL, 0x7477e41bUL,
+    0x6972d4a3UL, 0xa22e0706UL, 0x24ba75a8UL, 0xefe6a60dUL, 0x1d661643UL,
+    0xd63ac5e6UL, 0x50aeb748UL, 0x9bf264edUL, 0x86f75455UL, 0x4dab87f0UL,
+    0xcb3ff55eUL, 0x006326fbUL, 0xf135942eUL, 0x3a69478bUL, 0xbcfd3525UL,
+    0x77a1e680UL, 0x6aa4d638UL, 0xa1f8059dUL, 0x276c7733UL, 0xec30a496UL,
+    0x191c11eeUL, 0xd240c24bUL, 0x54d4b0e5UL, 0x9f886340UL, 0x828d53f8UL,
+    0x49d1805dUL, 0xcf45f2f3UL, 0x04192156UL, 0xf54f9383UL, 0x3e134026UL,
+    0xb8873288UL, 0x73dbe12dUL, 0x6eded195UL, 0xa5820230UL, 0x2316709eUL,
+    0xe84aa33bUL, 0x1aca1375UL, 0xd196c0d0UL, 0x5702b27eUL, 0x9c5e61dbUL,
+    0x815b5163UL, 0x4a0782c6UL, 0xcc93f068UL, 0x07cf23cdUL, 0xf6999118UL,
+    0x3dc542bdUL, 0xbb513013UL, 0x700de3b6UL, 0x6d08d30eUL, 0xa65400abUL,
+    0x20c07205UL, 0xeb9ca1a0UL, 0x11e81eb4UL, 0xdab4cd11UL, 0x5c20bfbfUL,
+    0x977c6c1aUL, 0x8a795ca2UL, 0x41258f07UL, 0xc7b1fda9UL, 0x0ced2e0cUL,
+    0xfdbb9cd9UL, 0x36e74f7cUL, 0xb0733dd2UL, 0x7b2fee77UL, 0x662adecfUL,
+    0xad760d6aUL, 0x2be27fc4UL, 0xe0beac61UL, 0x123e1c2fUL, 0xd962cf8aUL,
+    0x5ff6bd24UL, 0x94aa6e81UL, 0x89af5e39UL, 0x42f38d9cUL, 0xc467ff32UL,
+    0x0f3b2c97UL, 0xfe6d9e42UL, 0x35314de7UL, 0xb3a53f49UL, 0x78f9ececUL,
+    0x65fcdc54UL, 0xaea00ff1UL, 0x28347d5fUL, 0xe368aefaUL, 0x16441b82UL,
+    0xdd18c827UL, 0x5b8cba89UL, 0x90d0692cUL, 0x8dd55994UL, 0x46898a31UL,
+    0xc01df89fUL, 0x0b412b3aUL, 0xfa1799efUL, 0x314b4a4aUL, 0xb7df38e4UL,
+    0x7c83eb41UL, 0x6186dbf9UL, 0xaada085cUL, 0x2c4e7af2UL, 0xe712a957UL,
+    0x15921919UL, 0xdececabcUL, 0x585ab812UL, 0x93066bb7UL, 0x8e035b0fUL,
+    0x455f88aaUL, 0xc3cbfa04UL, 0x089729a1UL, 0xf9c19b74UL, 0x329d48d1UL,
+    0xb4093a7fUL, 0x7f55e9daUL, 0x6250d962UL, 0xa90c0ac7UL, 0x2f987869UL,
+    0xe4c4abccUL
+  },
+  {
+    0x00000000UL, 0xa6770bb4UL, 0x979f1129UL, 0x31e81a9dUL, 0xf44f2413UL,
+    0x52382fa7UL, 0x63d0353aUL, 0xc5a73e8eUL, 0x33ef4e67UL, 0x959845d3UL,
+    0xa4705f4eUL, 0x020754faUL, 0xc7a06a74UL, 0x61d761c0UL, 0x503f7b5dUL,
+    0xf64870e9UL, 0x67de9cceUL, 0xc1a9977aUL, 0xf0418de7UL, 0x56368653UL,
+    0x9391b8ddUL, 0x35e6b369UL, 0x040ea9f4UL, 0xa279a240UL, 0x5431d2a9UL,
+    0xf246d91dUL, 0xc3aec380UL, 0x65d9c834UL, 0xa07ef6baUL, 0x0609fd0eUL,
+    0x37e1e793UL, 0x9196ec27UL, 0xcfbd399cUL, 0x69ca3228UL, 0x582228b5UL,
+    0xfe552301UL, 0x3bf21d8fUL, 0x9d85163bUL, 0xac6d0ca6UL, 0x0a1a0712UL,
+    0xfc5277fbUL, 0x5a257c4fUL, 0x6bcd66d2UL, 0xcdba6d66UL, 0x081d53e8UL,
+    0xae6a585cUL, 0x9f8242c1UL, 0x39f54975UL, 0xa863a552UL, 0x0e14aee6UL,
+    0x3ffcb47bUL, 0x998bbfcfUL, 0x5c2c8141UL, 0xfa5b8af5UL, 0xcbb39068UL,
+    0x6dc49bdcUL, 0x9b8ceb35UL, 0x3dfbe081UL, 0x0c13fa1cUL, 0xaa64f1a8UL,
+    0x6fc3cf26UL, 0xc9b4c492UL, 0xf85cde0fUL, 0x5e2bd5bbUL, 0x440b7579UL,
+    0xe27c7ecdUL, 0xd3946450UL, 0x75e36fe4UL, 0xb044516aUL, 0x16335adeUL,
+    0x27db4043UL, 0x81ac4bf7UL, 0x77e43b1eUL, 0xd19330aaUL, 0xe07b2a37UL,
+    0x460c2183UL, 0x83ab1f0dUL, 0x25dc14b9UL, 0x14340e24UL, 0xb2430590UL,
+    0x23d5e9b7UL, 0x85a2e203UL, 0xb44af89eUL, 0x123df32aUL, 0xd79acda4UL,
+    0x71edc610UL, 0x4005dc8dUL, 0xe672d739UL, 0x103aa7d0UL, 0xb64dac64UL,
+    0x87a5b6f9UL, 0x21d2bd4dUL, 0xe47583c3UL, 0x42028877UL, 0x73ea92eaUL,
+    0xd59d995eUL, 0x8bb64ce5UL, 0x2dc14751UL, 0x1c295dccUL, 0xba5e5678UL,
+    0x7ff968f6UL, 0xd98e6342UL, 0xe86679dfUL, 0x4e11726bUL, 0xb8590282UL,
+    0x1e2e0936UL, 0x2fc613abUL, 0x89b1181fUL, 0x4c162691UL, 0xea612d25UL,
+    0xdb8937b8UL, 0x7dfe3c0cUL, 0xec68d02bUL, 0x4a1fdb9fUL, 0x7bf7c102UL,
+    0xdd80cab6UL, 0x1827f438UL, 0xbe50ff8cUL, 0x8fb8e511UL, 0x29cfeea5UL,
+    0xdf879e4cUL, 0x79f095f8UL, 0x48188f65UL, 0xee6f84d1UL, 0x2bc8ba5fUL,
+    0x8dbfb1ebUL, 0xbc57ab76UL, 0x1a20a0c2UL, 0x8816eaf2UL, 0x2e61e146UL,
+    0x1f89fbdbUL, 0xb9fef06fUL, 0x7c59cee1UL, 0xda2ec555UL, 0xebc6dfc8UL,
+    0x4db1d47cUL, 0xbbf9a495UL, 0x1d8eaf21UL, 0x2c66b5bcUL, 0x8a11be08UL,
+    0x4fb68086UL, 0xe9c18b32UL, 0xd82991afUL, 0x7e5e9a1bUL, 0xefc8763cUL,
+    0x49bf7d88UL, 0x78576715UL, 0xde206ca1UL, 0x1b87522fUL, 0xbdf0599bUL,
+    0x8c184306UL, 0x2a6f48b2UL, 0xdc27385bUL, 0x7a5033efUL, 0x4bb82972UL,
+    0xedcf22c6UL, 0x28681c48UL, 0x8e1f17fcUL, 0xbff70d61UL, 0x198006d5UL,
+    0x47abd36eUL, 0xe1dcd8daUL, 0xd034c247UL, 0x7643c9f3UL, 0xb3e4f77dUL,
+    0x1593fcc9UL, 0x247be654UL, 0x820cede0UL, 0x74449d09UL, 0xd23396bdUL,
+    0xe3db8c20UL, 0x45ac8794UL, 0x800bb91aUL, 0x267cb2aeUL, 0x1794a833UL,
+    0xb1e3a387UL, 0x20754fa0UL, 0x86024414UL, 0xb7ea5e89UL, 0x119d553dUL,
+    0xd43a6bb3UL, 0x724d6007UL, 0x43a57a9aUL, 0xe5d2712eUL, 0x139a01c7UL,
+    0xb5ed0a73UL, 0x840510eeUL, 0x22721b5aUL, 0xe7d525d4UL, 0x41a22e60UL,
+    0x704a34fdUL, 0xd63d3f49UL, 0xcc1d9f8bUL, 0x6a6a943fUL, 0x5b828ea2UL,
+    0xfdf58516UL, 0x3852bb98UL, 0x9e25b02cUL, 0xafcdaab1UL, 0x09baa105UL,
+    0xfff2d1ecUL, 0x5985da58UL, 0x686dc0c5UL, 0xce1acb71UL, 0x0bbdf5ffUL,
+    0xadcafe4bUL, 0x9c22e4d6UL, 0x3a55ef62UL, 0xabc30345UL, 0x0db408f1UL,
+    0x3c5c126cUL, 0x9a2b19d8UL, 0x5f8c2756UL, 0xf9fb2ce2UL, 0xc813367fUL,
+    0x6e643dcbUL, 0x982c4d22UL, 0x3e5b4696UL, 0x0fb35c0bUL, 0xa9c457bfUL,
+    0x6c636931UL, 0xca146285UL, 0xfbfc7818UL, 0x5d8b73acUL, 0x03a0a617UL,
+    0xa5d7ada3UL, 0x943fb73eUL, 0x3248bc8aUL, 0xf7ef8204UL, 0x519889b0UL,
+    0x6070932dUL, 0xc6079899UL, 0x304fe870UL, 0x9638e3c4UL, 0xa7d0f959UL,
+    0x01a7f2edUL, 0xc400cc63UL, 0x6277c7d7UL, 0x539fdd4aUL, 0xf5e8d6feUL,
+    0x647e3ad9UL, 0xc209316dUL, 0xf3e12bf0UL, 0x55962044UL, 0x90311ecaUL,
+    0x3646157eUL, 0x07ae0fe3UL, 0xa1d90457UL, 0x579174beUL, 0xf1e67f0aUL,
+    0xc00e6597UL, 0x66796e23UL, 0xa3de50adUL, 0x05a95b19UL, 0x34414184UL,
+    0x92364a30UL
+  },
+  {
+    0x00000000UL, 0xccaa009eUL, 0x4225077dUL, 0x8e8f07e3UL, 0x844a0efaUL,
+    0x48e00e64UL, 0xc66f0987UL, 0x0ac50919UL, 0xd3e51bb5UL, 0x1f4f1b2bUL,
+    0x91c01cc8UL, 0x5d6a1c56UL, 0x57af154fUL, 0x9b0515d1UL, 0x158a1232UL,
+    0xd92012acUL, 0x7cbb312bUL, 0xb01131b5UL, 0x3e9e3656UL, 0xf23436c8UL,
+    0xf8f13fd1UL, 0x345b3f4fUL, 0xbad438acUL, 0x767e3832UL, 0xaf5e2a9eUL,
+    0x63f42a00UL, 0xed7b2de3UL, 0x21d12d7dUL, 0x2b142464UL, 0xe7be24faUL,
+    0x69312319UL, 0xa59b2387UL, 0xf9766256UL, 0x35dc62c8UL, 0xbb53652bUL,
+    0x77f965b5UL, 0x7d3c6cacUL, 0xb1966c32UL, 0x3f196bd1UL, 0xf3b36b4fUL,
+    0x2a9379e3UL, 0xe639797dUL, 0x68b67e9eUL, 0xa41c7e00UL, 0xaed97719UL,
+    0x62737787UL, 0xecfc7064UL, 0x205670faUL, 0x85cd537dUL, 0x496753e3UL,
+    0xc7e85400UL, 0x0b42549eUL, 0x01875d87UL, 0xcd2d5d19UL, 0x43a25afaUL,
+    0x8f085a64UL, 0x562848c8UL, 0x9a824856UL, 0x140d4fb5UL, 0xd8a74f2bUL,
+    0xd2624632UL, 0x1ec846acUL, 0x9047414fUL, 0x5ced41d1UL, 0x299dc2edUL,
+    0xe537c273UL, 0x6bb8c590UL, 0xa712c50eUL, 0xadd7cc17UL, 0x617dcc89UL,
+    0xeff2cb6aUL, 0x2358cbf4UL, 0xfa78d958UL, 0x36d2d9c6UL, 0xb85dde25UL,
+    0x74f7debbUL, 0x7e32d7a2UL, 0xb298d73cUL, 0x3c17d0dfUL, 0xf0bdd041UL,
+    0x5526f3c6UL, 0x998cf358UL, 0x1703f4bbUL, 0xdba9f425UL, 0xd16cfd3cUL,
+    0x1dc6fda2UL, 0x9349fa41UL, 0x5fe3fadfUL, 0x86c3e873UL, 0x4a69e8edUL,
+    0xc4e6ef0eUL, 0x084cef90UL, 0x0289e689UL, 0xce23e617UL, 0x40ace1f4UL,
+    0x8c06e16aUL, 0xd0eba0bbUL, 0x1c41a025UL, 0x92cea7c6UL, 0x5e64a758UL,
+    0x54a1ae41UL, 0x980baedfUL, 0x1684a93cUL, 0xda2ea9a2UL, 0x030ebb0eUL,
+    0xcfa4bb90UL, 0x412bbc73UL, 0x8d81bcedUL, 0x8744b5f4UL, 0x4beeb56aUL,
+    0xc561b289UL, 0x09cbb217UL, 0xac509190UL, 0x60fa910eUL, 0xee7596edUL,
+    0x22df9673UL, 0x281a9f6aUL, 0xe4b09ff4UL, 0x6a3f9817UL, 0xa6959889UL,
+    0x7fb58a25UL, 0xb31f8abbUL, 0x3d908d58UL, 0xf13a8dc6UL, 0xfbff84dfUL,
+    0x37558441UL, 0xb9da83a2UL, 0x7570833cUL, 0x533b85daUL, 0x9f918544UL,
+    0x111e82a7UL, 0xddb48239UL, 0xd7718b20UL, 0x1bdb8bbeUL, 0x95548c5dUL,
+    0x59fe8cc3UL, 0x80de9e6fUL, 0x4c749ef1UL, 0xc2fb9912UL, 0x0e51998cUL,
+    0x04949095UL, 0xc83e900bUL, 0x46b197e8UL, 0x8a1b9776UL, 0x2f80b4f1UL,
+    0xe32ab46fUL, 0x6da5b38cUL, 0xa10fb312UL, 0xabcaba0bUL, 0x6760ba95UL,
+    0xe9efbd76UL, 0x2545bde8UL, 0xfc65af44UL, 0x30cfafdaUL, 0xbe40a839UL,
+    0x72eaa8a7UL, 0x782fa1beUL, 0xb485a120UL, 0x3a0aa6c3UL, 0xf6a0a65dUL,
+    0xaa4de78cUL, 0x66e7e712UL, 0xe868e0f1UL, 0x24c2e06fUL, 0x2e07e976UL,
+    0xe2ade9e8UL, 0x6c22ee0bUL, 0xa088ee95UL, 0x79a8fc39UL, 0xb502fca7UL,
+    0x3b8dfb44UL, 0xf727fbdaUL, 0xfde2f2c3UL, 0x3148f25dUL, 0xbfc7f5beUL,
+    0x736df520UL, 0xd6f6d6a7UL, 0x1a5cd639UL, 0x94d3d1daUL, 0x5879d144UL,
+    0x52bcd85dUL, 0x9e16d8c3UL, 0x1099df20UL, 0xdc33dfbeUL, 0x0513cd12UL,
+    0xc9b9cd8cUL, 0x4736ca6fUL, 0x8b9ccaf1UL, 0x8159c3e8UL, 0x4df3c376UL,
+    0xc37cc495UL, 0x0fd6c40bUL, 0x7aa64737UL, 0xb60c47a9UL, 0x3883404aUL,
+    0xf42940d4UL, 0xfeec49cdUL, 0x32464953UL, 0xbcc94eb0UL, 0x70634e2eUL,
+    0xa9435c82UL, 0x65e95c1cUL, 0xeb665bffUL, 0x27cc5b61UL, 0x2d095278UL,
+    0xe1a352e6UL, 0x6f2c5505UL, 0xa386559bUL, 0x061d761cUL, 0xcab77682UL,
+    0x44387161UL, 0x889271ffUL, 0x825778e6UL, 0x4efd7878UL, 0xc0727f9bUL,
+    0x0cd87f05UL, 0xd5f86da9UL, 0x19526d37UL, 0x97dd6ad4UL, 0x5b776a4aUL,
+    0x51b26353UL, 0x9d1863cdUL, 0x1397642eUL, 0xdf3d64b0UL, 0x83d02561UL,
+    0x4f7a25ffUL, 0xc1f5221cUL, 0x0d5f2282UL, 0x079a2b9bUL, 0xcb302b05UL,
+    0x45bf2ce6UL, 0x89152c78UL, 0x50353ed4UL, 0x9c9f3e4aUL, 0x121039a9UL,
+    0xdeba3937UL, 0xd47f302eUL, 0x18d530b0UL, 0x965a3753UL, 0x5af037cdUL,
+    0xff6b144aUL, 0x33c114d4UL, 0xbd4e1337UL, 0x71e413a9UL, 0x7b211ab0UL,
+    0xb78b1a2eUL, 0x39041dcdUL, 0xf5ae1d53UL, 0x2c8e0fffUL, 0xe0240f61UL,
+    0x6eab0882UL, 0xa201081cUL, 0xa8c40105UL, 0x646e019bUL, 0xeae10678UL,
+    0x264b06e6UL
+  },
   {
     0x00000000UL, 0x96300777UL, 0x2c610eeeUL, 0xba510999UL, 0x19c46d07UL,
     0x8ff46a70UL, 0x35a563e9UL, 0xa395649eUL, 0x3288db0eUL, 0xa4b8dc79UL,
@@ -436,6 +652,1334 @@ local const z_crc_t FAR crc_table[TBLS][256] =
     0x95e6b8b1UL, 0x7b490da3UL, 0x1e2eb11bUL, 0x483ed243UL, 0x2d596efbUL,
     0xc3f6dbe9UL, 0xa6916751UL, 0x1fa9b0ccUL, 0x7ace0c74UL, 0x9461b966UL,
     0xf10605deUL
+  },
+  {
+    0x00000000UL, 0xb029603dUL, 0x6053c07aUL, 0xd07aa047UL, 0xc0a680f5UL,
+    0x708fe0c8UL, 0xa0f5408fUL, 0x10dc20b2UL, 0xc14b7030UL, 0x7162100dUL,
+    0xa118b04aUL, 0x1131d077UL, 0x01edf0c5UL, 0xb1c490f8UL, 0x61be30bfUL,
+    0xd1975082UL, 0x8297e060UL, 0x32be805dUL, 0xe2c4201aUL, 0x52ed4027UL,
+    0x42316095UL, 0xf21800a8UL, 0x2262a0efUL, 0x924bc0d2UL, 0x43dc9050UL,
+    0xf3f5f06dUL, 0x238f502aUL, 0x93a63017UL, 0x837a10a5UL, 0x33537098UL,
+    0xe329d0dfUL, 0x5300b0e2UL, 0x042fc1c1UL, 0xb406a1fcUL, 0x647c01bbUL,
+    0xd4556186UL, 0xc4894134UL, 0x74a02109UL, 0xa4da814eUL, 0x14f3e173UL,
+    0xc564b1f1UL, 0x754dd1ccUL, 0xa537718bUL, 0x151e11b6UL, 0x05c23104UL,
+    0xb5eb5139UL, 0x6591f17eUL, 0xd5b89143UL, 0x86b821a1UL, 0x3691419cUL,
+    0xe6ebe1dbUL, 0x56c281e6UL, 0x461ea154UL, 0xf637c169UL, 0x264d612eUL,
+    0x96640113UL, 0x47f35191UL, 0xf7da31acUL, 0x27a091ebUL, 0x9789f1d6UL,
+    0x8755d164UL, 0x377cb159UL, 0xe706111eUL, 0x572f7123UL, 0x4958f358UL,
+    0xf9719365UL, 0x290b3322UL, 0x9922531fUL, 0x89fe73adUL, 0x39d71390UL,
+    0xe9adb3d7UL, 0x5984d3eaUL, 0x88138368UL, 0x383ae355UL, 0xe8404312UL,
+    0x5869232fUL, 0x48b5039dUL, 0xf89c63a0UL, 0x28e6c3e7UL, 0x98cfa3daUL,
+    0xcbcf1338UL, 0x7be67305UL, 0xab9cd342UL, 0x1bb5b37fUL, 0x0b6993cdUL,
+    0xbb40f3f0UL, 0x6b3a53b7UL, 0xdb13338aUL, 0x0a846308UL, 0xbaad0335UL,
+    0x6ad7a372UL, 0xdafec34fUL, 0xca22e3fdUL, 0x7a0b83c0UL, 0xaa712387UL,
+    0x1a5843baUL, 0x4d773299UL, 0xfd5e52a4UL, 0x2d24f2e3UL, 0x9d0d92deUL,
+    0x8dd1b26cUL, 0x3df8d251UL, 0xed827216UL, 0x5dab122bUL, 0x8c3c42a9UL,
+    0x3c152294UL, 0xec6f82d3UL, 0x5c46e2eeUL, 0x4c9ac25cUL, 0xfcb3a261UL,
+    0x2cc90226UL, 0x9ce0621bUL, 0xcfe0d2f9UL, 0x7fc9b2c4UL, 0xafb31283UL,
+    0x1f9a72beUL, 0x0f46520cUL, 0xbf6f3231UL, 0x6f159276UL, 0xdf3cf24bUL,
+    0x0eaba2c9UL, 0xbe82c2f4UL, 0x6ef862b3UL, 0xded1028eUL, 0xce0d223cUL,
+    0x7e244201UL, 0xae5ee246UL, 0x1e77827bUL, 0x92b0e6b1UL, 0x2299868cUL,
+    0xf2e326cbUL, 0x42ca46f6UL, 0x52166644UL, 0xe23f0679UL, 0x3245a63eUL,
+    0x826cc603UL, 0x53fb9681UL, 0xe3d2f6bcUL, 0x33a856fbUL, 0x838136c6UL,
+    0x935d1674UL, 0x23747649UL, 0xf30ed60eUL, 0x4327b633UL, 0x102706d1UL,
+    0xa00e66ecUL, 0x7074c6abUL, 0xc05da696UL, 0xd0818624UL, 0x60a8e619UL,
+    0xb0d2465eUL, 0x00fb2663UL, 0xd16c76e1UL, 0x614516dcUL, 0xb13fb69bUL,
+    0x0116d6a6UL, 0x11caf614UL, 0xa1e39629UL, 0x7199366eUL, 0xc1b05653UL,
+    0x969f2770UL, 0x26b6474dUL, 0xf6cce70aUL, 0x46e58737UL, 0x5639a785UL,
+    0xe610c7b8UL, 0x366a67ffUL, 0x864307c2UL, 0x57d45740UL, 0xe7fd377dUL,
+    0x3787973aUL, 0x87aef707UL, 0x9772d7b5UL, 0x275bb788UL, 0xf72117cfUL,
+    0x470877f2UL, 0x1408c710UL, 0xa421a72dUL, 0x745b076aUL, 0xc4726757UL,
+    0xd4ae47e5UL, 0x648727d8UL, 0xb4fd879fUL, 0x04d4e7a2UL, 0xd543b720UL,
+    0x656ad71dUL, 0xb510775aUL, 0x05391767UL, 0x15e537d5UL, 0xa5cc57e8UL,
+    0x75b6f7afUL, 0xc59f9792UL, 0xdbe815e9UL, 0x6bc175d4UL, 0xbbbbd593UL,
+    0x0b92b5aeUL, 0x1b4e951cUL, 0xab67f521UL, 0x7b1d5566UL, 0xcb34355bUL,
+    0x1aa365d9UL, 0xaa8a05e4UL, 0x7af0a5a3UL, 0xcad9c59eUL, 0xda05e52cUL,
+    0x6a2c8511UL, 0xba562556UL, 0x0a7f456bUL, 0x597ff589UL, 0xe95695b4UL,
+    0x392c35f3UL, 0x890555ceUL, 0x99d9757cUL, 0x29f01541UL, 0xf98ab506UL,
+    0x49a3d53bUL, 0x983485b9UL, 0x281de584UL, 0xf86745c3UL, 0x484e25feUL,
+    0x5892054cUL, 0xe8bb6571UL, 0x38c1c536UL, 0x88e8a50bUL, 0xdfc7d428UL,
+    0x6feeb415UL, 0xbf941452UL, 0x0fbd746fUL, 0x1f6154ddUL, 0xaf4834e0UL,
+    0x7f3294a7UL, 0xcf1bf49aUL, 0x1e8ca418UL, 0xaea5c425UL, 0x7edf6462UL,
+    0xcef6045fUL, 0xde2a24edUL, 0x6e0344d0UL, 0xbe79e497UL, 0x0e5084aaUL,
+    0x5d503448UL, 0xed795475UL, 0x3d03f432UL, 0x8d2a940fUL, 0x9df6b4bdUL,
+    0x2ddfd480UL, 0xfda574c7UL, 0x4d8c14faUL, 0x9c1b4478UL, 0x2c322445UL,
+    0xfc488402UL, 0x4c61e43fUL, 0x5cbdc48dUL, 0xec94a4b0UL, 0x3cee04f7UL,
+    0x8cc764caUL
+  },
+  {
+    0x00000000UL, 0xa5d35ccbUL, 0x0ba1c84dUL, 0xae729486UL, 0x1642919bUL,
+    0xb391cd50UL, 0x1de359d6UL, 0xb830051dUL, 0x6d8253ecUL, 0xc8510f27UL,
+    0x66239ba1UL, 0xc3f0c76aUL, 0x7bc0c277UL, 0xde139ebcUL, 0x70610a3aUL,
+    0xd5b256f1UL, 0x9b02d603UL, 0x3ed18ac8UL, 0x90a31e4eUL, 0x35704285UL,
+    0x8d404798UL, 0x28931b53UL, 0x86e18fd5UL, 0x2332d31eUL, 0xf68085efUL,
+    0x5353d924UL, 0xfd214da2UL, 0x58f21169UL, 0xe0c21474UL, 0x451148bfUL,
+    0xeb63dc39UL, 0x4eb080f2UL, 0x3605ac07UL, 0x93d6f0ccUL, 0x3da4644aUL,
+    0x98773881UL, 0x20473d9cUL, 0x85946157UL, 0x2be6f5d1UL, 0x8e35a91aUL,
+    0x5b87ffebUL, 0xfe54a320UL, 0x502637a6UL, 0xf5f56b6dUL, 0x4dc56e70UL,
+    0xe81632bbUL, 0x4664a63dUL, 0xe3b7faf6UL, 0xad077a04UL, 0x08d426cfUL,
+    0xa6a6b249UL, 0x0375ee82UL, 0xbb45eb9fUL, 0x1e96b754UL, 0xb0e423d2UL,
+    0x15377f19UL, 0xc08529e8UL, 0x65567523UL, 0xcb24e1a5UL, 0x6ef7bd6eUL,
+    0xd6c7b873UL, 0x7314e4b8UL, 0xdd66703eUL, 0x78b52cf5UL, 0x6c0a580fUL,
+    0xc9d904c4UL, 0x67ab9042UL, 0xc278cc89UL, 0x7a48c994UL, 0xdf9b955fUL,
+    0x71e901d9UL, 0xd43a5d12UL, 0x01880be3UL, 0xa45b5728UL, 0x0a29c3aeUL,
+    0xaffa9f65UL, 0x17ca9a78UL, 0xb219c6b3UL, 0x1c6b5235UL, 0xb9b80efeUL,
+    0xf7088e0cUL, 0x52dbd2c7UL, 0xfca94641UL, 0x597a1a8aUL, 0xe14a1f97UL,
+    0x4499435cUL, 0xeaebd7daUL, 0x4f388b11UL, 0x9a8adde0UL, 0x3f59812bUL,
+    0x912b15adUL, 0x34f84966UL, 0x8cc84c7bUL, 0x291b10b0UL, 0x87698436UL,
+    0x22bad8fdUL, 0x5a0ff408UL, 0xffdca8c3UL, 0x51ae3c45UL, 0xf47d608eUL,
+    0x4c4d6593UL, 0xe99e3958UL, 0x47ecaddeUL, 0xe23ff115UL, 0x378da7e4UL,
+    0x925efb2fUL, 0x3c2c6fa9UL, 0x99ff3362UL, 0x21cf367fUL, 0x841c6ab4UL,
+    0x2a6efe32UL, 0x8fbda2f9UL, 0xc10d220bUL, 0x64de7ec0UL, 0xcaacea46UL,
+    0x6f7fb68dUL, 0xd74fb390UL, 0x729cef5bUL, 0xdcee7bddUL, 0x793d2716UL,
+    0xac8f71e7UL, 0x095c2d2cUL, 0xa72eb9aaUL, 0x02fde561UL, 0xbacde07cUL,
+    0x1f1ebcb7UL, 0xb16c2831UL, 0x14bf74faUL, 0xd814b01eUL, 0x7dc7ecd5UL,
+    0xd3b57853UL, 0x76662498UL, 0xce562185UL, 0x6b857d4eUL, 0xc5f7e9c8UL,
+    0x6024b503UL, 0xb596e3f2UL, 0x1045bf39UL, 0xbe372bbfUL, 0x1be47774UL,
+    0xa3d47269UL, 0x06072ea2UL, 0xa875ba24UL, 0x0da6e6efUL, 0x4316661dUL,
+    0xe6c53ad6UL, 0x48b7ae50UL, 0xed64f29bUL, 0x5554f786UL, 0xf087ab4dUL,
+    0x5ef53fcbUL, 0xfb266300UL, 0x2e9435f1UL, 0x8b47693aUL, 0x2535fdbcUL,
+    0x80e6a177UL, 0x38d6a46aUL, 0x9d05f8a1UL, 0x33776c27UL, 0x96a430ecUL,
+    0xee111c19UL, 0x4bc240d2UL, 0xe5b0d454UL, 0x4063889fUL, 0xf8538d82UL,
+    0x5d80d149UL, 0xf3f245cfUL, 0x56211904UL, 0x83934ff5UL, 0x2640133eUL,
+    0x883287b8UL, 0x2de1db73UL, 0x95d1de6eUL, 0x300282a5UL, 0x9e701623UL,
+    0x3ba34ae8UL, 0x7513ca1aUL, 0xd0c096d1UL, 0x7eb20257UL, 0xdb615e9cUL,
+    0x63515b81UL, 0xc682074aUL, 0x68f093ccUL, 0xcd23cf07UL, 0x189199f6UL,
+    0xbd42c53dUL, 0x133051bbUL, 0xb6e30d70UL, 0x0ed3086dUL, 0xab0054a6UL,
+    0x0572c020UL, 0xa0a19cebUL, 0xb41ee811UL, 0x11cdb4daUL, 0xbfbf205cUL,
+    0x1a6c7c97UL, 0xa25c798aUL, 0x078f2541UL, 0xa9fdb1c7UL, 0x0c2eed0cUL,
+    0xd99cbbfdUL, 0x7c4fe736UL, 0xd23d73b0UL, 0x77ee2f7bUL, 0xcfde2a66UL,
+    0x6a0d76adUL, 0xc47fe22bUL, 0x61acbee0UL, 0x2f1c3e12UL, 0x8acf62d9UL,
+    0x24bdf65fUL, 0x816eaa94UL, 0x395eaf89UL, 0x9c8df342UL, 0x32ff67c4UL,
+    0x972c3b0fUL, 0x429e6dfeUL, 0xe74d3135UL, 0x493fa5b3UL, 0xececf978UL,
+    0x54dcfc65UL, 0xf10fa0aeUL, 0x5f7d3428UL, 0xfaae68e3UL, 0x821b4416UL,
+    0x27c818ddUL, 0x89ba8c5bUL, 0x2c69d090UL, 0x9459d58dUL, 0x318a8946UL,
+    0x9ff81dc0UL, 0x3a2b410bUL, 0xef9917faUL, 0x4a4a4b31UL, 0xe438dfb7UL,
+    0x41eb837cUL, 0xf9db8661UL, 0x5c08daaaUL, 0xf27a4e2cUL, 0x57a912e7UL,
+    0x19199215UL, 0xbccacedeUL, 0x12b85a58UL, 0xb76b0693UL, 0x0f5b038eUL,
+    0xaa885f45UL, 0x04facbc3UL, 0xa1299708UL, 0x749bc1f9UL, 0xd1489d32UL,
+    0x7f3a09b4UL, 0xdae9557fUL, 0x62d95062UL, 0xc70a0ca9UL, 0x6978982fUL,
+    0xccabc4e4UL
+  },
+  {
+    0x00000000UL, 0xb40b77a6UL, 0x29119f97UL, 0x9d1ae831UL, 0x13244ff4UL,
+    0xa72f3852UL, 0x3a35d063UL, 0x8e3ea7c5UL, 0x674eef33UL, 0xd3459895UL,
+    0x4e5f70a4UL, 0xfa540702UL, 0x746aa0c7UL, 0xc061d761UL, 0x5d7b3f50UL,
+    0xe97048f6UL, 0xce9cde67UL, 0x7a97a9c1UL, 0xe78d41f0UL, 0x53863656UL,
+    0xddb89193UL, 0x69b3e635UL, 0xf4a90e04UL, 0x40a279a2UL, 0xa9d23154UL,
+    0x1dd946f2UL, 0x80c3aec3UL, 0x34c8d965UL, 0xbaf67ea0UL, 0x0efd0906UL,
+    0x93e7e137UL, 0x27ec9691UL, 0x9c39bdcfUL, 0x2832ca69UL, 0xb5282258UL,
+    0x012355feUL, 0x8f1df23bUL, 0x3b16859dUL, 0xa60c6dacUL, 0x12071a0aUL,
+    0xfb7752fcUL, 0x4f7c255aUL, 0xd266cd6bUL, 0x666dbacdUL, 0xe8531d08UL,
+    0x5c586aaeUL, 0xc142829fUL, 0x7549f539UL, 0x52a563a8UL, 0xe6ae140eUL,
+    0x7bb4fc3fUL, 0xcfbf8b99UL, 0x41812c5cUL, 0xf58a5bfaUL, 0x6890b3cbUL,
+    0xdc9bc46dUL, 0x35eb8c9bUL, 0x81e0fb3dUL, 0x1cfa130cUL, 0xa8f164aaUL,
+    0x26cfc36fUL, 0x92c4b4c9UL, 0x0fde5cf8UL, 0xbbd52b5eUL, 0x79750b44UL,
+    0xcd7e7ce2UL, 0x506494d3UL, 0xe46fe375UL, 0x6a5144b0UL, 0xde5a3316UL,
+    0x4340db27UL, 0xf74bac81UL, 0x1e3be477UL, 0xaa3093d1UL, 0x372a7be0UL,
+    0x83210c46UL, 0x0d1fab83UL, 0xb914dc25UL, 0x240e3414UL, 0x900543b2UL,
+    0xb7e9d523UL, 0x03e2a285UL, 0x9ef84ab4UL, 0x2af33d12UL, 0xa4cd9ad7UL,
+    0x10c6ed71UL, 0x8ddc0540UL, 0x39d772e6UL, 0xd0a73a10UL, 0x64ac4db6UL,
+    0xf9b6a587UL, 0x4dbdd221UL, 0xc38375e4UL, 0x77880242UL, 0xea92ea73UL,
+    0x5e999dd5UL, 0xe54cb68bUL, 0x5147c12dUL, 0xcc5d291cUL, 0x78565ebaUL,
+    0xf668f97fUL, 0x42638ed9UL, 0xdf7966e8UL, 0x6b72114eUL, 0x820259b8UL,
+    0x36092e1eUL, 0xab13c62fUL, 0x1f18b189UL, 0x9126164cUL, 0x252d61eaUL,
+    0xb83789dbUL, 0x0c3cfe7dUL, 0x2bd068ecUL, 0x9fdb1f4aUL, 0x02c1f77bUL,
+    0xb6ca80ddUL, 0x38f42718UL, 0x8cff50beUL, 0x11e5b88fUL, 0xa5eecf29UL,
+    0x4c9e87dfUL, 0xf895f079UL, 0x658f1848UL, 0xd1846feeUL, 0x5fbac82bUL,
+    0xebb1bf8dUL, 0x76ab57bcUL, 0xc2a0201aUL, 0xf2ea1688UL, 0x46e1612eUL,
+    0xdbfb891fUL, 0x6ff0feb9UL, 0xe1ce597cUL, 0x55c52edaUL, 0xc8dfc6ebUL,
+    0x7cd4b14dUL, 0x95a4f9bbUL, 0x21af8e1dUL, 0xbcb5662cUL, 0x08be118aUL,
+    0x8680b64fUL, 0x328bc1e9UL, 0xaf9129d8UL, 0x1b9a5e7eUL, 0x3c76c8efUL,
+    0x887dbf49UL, 0x15675778UL, 0xa16c20deUL, 0x2f52871bUL, 0x9b59f0bdUL,
+    0x0643188cUL, 0xb2486f2aUL, 0x5b3827dcUL, 0xef33507aUL, 0x7229b84bUL,
+    0xc622cfedUL, 0x481c6828UL, 0xfc171f8eUL, 0x610df7bfUL, 0xd5068019UL,
+    0x6ed3ab47UL, 0xdad8dce1UL, 0x47c234d0UL, 0xf3c94376UL, 0x7df7e4b3UL,
+    0xc9fc9315UL, 0x54e67b24UL, 0xe0ed0c82UL, 0x099d4474UL, 0xbd9633d2UL,
+    0x208cdbe3UL, 0x9487ac45UL, 0x1ab90b80UL, 0xaeb27c26UL, 0x33a89417UL,
+    0x87a3e3b1UL, 0xa04f7520UL, 0x14440286UL, 0x895eeab7UL, 0x3d559d11UL,
+    0xb36b3ad4UL, 0x07604d72UL, 0x9a7aa543UL, 0x2e71d2e5UL, 0xc7019a13UL,
+    0x730aedb5UL, 0xee100584UL, 0x5a1b7222UL, 0xd425d5e7UL, 0x602ea241UL,
+    0xfd344a70UL, 0x493f3dd6UL, 0x8b9f1dccUL, 0x3f946a6aUL, 0xa28e825bUL,
+    0x1685f5fdUL, 0x98bb5238UL, 0x2cb0259eUL, 0xb1aacdafUL, 0x05a1ba09UL,
+    0xecd1f2ffUL, 0x58da8559UL, 0xc5c06d68UL, 0x71cb1aceUL, 0xfff5bd0bUL,
+    0x4bfecaadUL, 0xd6e4229cUL, 0x62ef553aUL, 0x4503c3abUL, 0xf108b40dUL,
+    0x6c125c3cUL, 0xd8192b9aUL, 0x56278c5fUL, 0xe22cfbf9UL, 0x7f3613c8UL,
+    0xcb3d646eUL, 0x224d2c98UL, 0x96465b3eUL, 0x0b5cb30fUL, 0xbf57c4a9UL,
+    0x3169636cUL, 0x856214caUL, 0x1878fcfbUL, 0xac738b5dUL, 0x17a6a003UL,
+    0xa3add7a5UL, 0x3eb73f94UL, 0x8abc4832UL, 0x0482eff7UL, 0xb0899851UL,
+    0x2d937060UL, 0x999807c6UL, 0x70e84f30UL, 0xc4e33896UL, 0x59f9d0a7UL,
+    0xedf2a701UL, 0x63cc00c4UL, 0xd7c77762UL, 0x4add9f53UL, 0xfed6e8f5UL,
+    0xd93a7e64UL, 0x6d3109c2UL, 0xf02be1f3UL, 0x44209655UL, 0xca1e3190UL,
+    0x7e154636UL, 0xe30fae07UL, 0x5704d9a1UL, 0xbe749157UL, 0x0a7fe6f1UL,
+    0x97650ec0UL, 0x236e7966UL, 0xad50dea3UL, 0x195ba905UL, 0x84414134UL,
+    0x304a3692UL
+  },
+  {
+    0x00000000UL, 0x9e00aaccUL, 0x7d072542UL, 0xe3078f8eUL, 0xfa0e4a84UL,
+    0x640ee048UL, 0x87096fc6UL, 0x1909c50aUL, 0xb51be5d3UL, 0x2b1b4f1fUL,
+    0xc81cc091UL, 0x561c6a5dUL, 0x4f15af57UL, 0xd115059bUL, 0x32128a15UL,
+    0xac1220d9UL, 0x2b31bb7cUL, 0xb53111b0UL, 0x56369e3eUL, 0xc83634f2UL,
+    0xd13ff1f8UL, 0x4f3f5b34UL, 0xac38d4baUL, 0x32387e76UL, 0x9e2a5eafUL,
+    0x002af463UL, 0xe32d7bedUL, 0x7d2dd121UL, 0x6424142bUL, 0xfa24bee7UL,
+    0x19233169UL, 0x87239ba5UL, 0x566276f9UL, 0xc862dc35UL, 0x2b6553bbUL,
+    0xb565f977UL, 0xac6c3c7dUL, 0x326c96b1UL, 0xd16b193fUL, 0x4f6bb3f3UL,
+    0xe379932aUL, 0x7d7939e6UL, 0x9e7eb668UL, 0x007e1ca4UL, 0x1977d9aeUL,
+    0x87777362UL, 0x6470fcecUL, 0xfa705620UL, 0x7d53cd85UL, 0xe3536749UL,
+    0x0054e8c7UL, 0x9e54420bUL, 0x875d8701UL, 0x195d2dcdUL, 0xfa5aa243UL,
+    0x645a088fUL, 0xc8482856UL, 0x5648829aUL, 0xb54f0d14UL, 0x2b4fa7d8UL,
+    0x324662d2UL, 0xac46c81eUL, 0x4f414790UL, 0xd141ed5cUL, 0xedc29d29UL,
+    0x73c237e5UL, 0x90c5b86bUL, 0x0ec512a7UL, 0x17ccd7adUL, 0x89cc7d61UL,
+    0x6acbf2efUL, 0xf4cb5823UL, 0x58d978faUL, 0xc6d9d236UL, 0x25de5db8UL,
+    0xbbdef774UL, 0xa2d7327eUL, 0x3cd798b2UL, 0xdfd0173cUL, 0x41d0bdf0UL,
+    0xc6f32655UL, 0x58f38c99UL, 0xbbf40317UL, 0x25f4a9dbUL, 0x3cfd6cd1UL,
+    0xa2fdc61dUL, 0x41fa4993UL, 0xdffae35fUL, 0x73e8c386UL, 0xede8694aUL,
+    0x0eefe6c4UL, 0x90ef4c08UL, 0x89e68902UL, 0x17e623ceUL, 0xf4e1ac40UL,
+    0x6ae1068cUL, 0xbba0ebd0UL, 0x25a0411cUL, 0xc6a7ce92UL, 0x58a7645eUL,
+    0x41aea154UL, 0xdfae0b98UL, 0x3ca98416UL, 0xa2a92edaUL, 0x0ebb0e03UL,
+    0x90bba4cfUL, 0x73bc2b41UL, 0xedbc818dUL, 0xf4b54487UL, 0x6ab5ee4bUL,
+    0x89b261c5UL, 0x17b2cb09UL, 0x909150acUL, 0x0e91fa60UL, 0xed9675eeUL,
+    0x7396df22UL, 0x6a9f1a28UL, 0xf49fb0e4UL, 0x17983f6aUL, 0x899895a6UL,
+    0x258ab57fUL, 0xbb8a1fb3UL, 0x588d903dUL, 0xc68d3af1UL, 0xdf84fffbUL,
+    0x41845537UL, 0xa283dab9UL, 0x3c837075UL, 0xda853b53UL, 0x4485919fUL,
+    0xa7821e11UL, 0x3982b4ddUL, 0x208b71d7UL, 0xbe8bdb1bUL, 0x5d8c5495UL,
+    0xc38cfe59UL, 0x6f9ede80UL, 0xf19e744cUL, 0x1299fbc2UL, 0x8c99510eUL,
+    0x95909404UL, 0x0b903ec8UL, 0xe897b146UL, 0x76971b8aUL, 0xf1b4802fUL,
+    0x6fb42ae3UL, 0x8cb3a56dUL, 0x12b30fa1UL, 0x0bbacaabUL, 0x95ba6067UL,
+    0x76bdefe9UL, 0xe8bd4525UL, 0x44af65fcUL, 0xdaafcf30UL, 0x39a840beUL,
+    0xa7a8ea72UL, 0xbea12f78UL, 0x20a185b4UL, 0xc3a60a3aUL, 0x5da6a0f6UL,
+    0x8ce74daaUL, 0x12e7e766UL, 0xf1e068e8UL, 0x6fe0c224UL, 0x76e9072eUL,
+    0xe8e9ade2UL, 0x0bee226cUL, 0x95ee88a0UL, 0x39fca879UL, 0xa7fc02b5UL,
+    0x44fb8d3bUL, 0xdafb27f7UL, 0xc3f2e2fdUL, 0x5df24831UL, 0xbef5c7bfUL,
+    0x20f56d73UL, 0xa7d6f6d6UL, 0x39d65c1aUL, 0xdad1d394UL, 0x44d17958UL,
+    0x5dd8bc52UL, 0xc3d8169eUL, 0x20df9910UL, 0xbedf33dcUL, 0x12cd1305UL,
+    0x8ccdb9c9UL, 0x6fca3647UL, 0xf1ca9c8bUL, 0xe8c35981UL, 0x76c3f34dUL,
+    0x95c47cc3UL, 0x0bc4d60fUL, 0x3747a67aUL, 0xa9470cb6UL, 0x4a408338UL,
+    0xd44029f4UL, 0xcd49ecfeUL, 0x53494632UL, 0xb04ec9bcUL, 0x2e4e6370UL,
+    0x825c43a9UL, 0x1c5ce965UL, 0xff5b66ebUL, 0x615bcc27UL, 0x7852092dUL,
+    0xe652a3e1UL, 0x05552c6fUL, 0x9b5586a3UL, 0x1c761d06UL, 0x8276b7caUL,
+    0x61713844UL, 0xff719288UL, 0xe6785782UL, 0x7878fd4eUL, 0x9b7f72c0UL,
+    0x057fd80cUL, 0xa96df8d5UL, 0x376d5219UL, 0xd46add97UL, 0x4a6a775bUL,
+    0x5363b251UL, 0xcd63189dUL, 0x2e649713UL, 0xb0643ddfUL, 0x6125d083UL,
+    0xff257a4fUL, 0x1c22f5c1UL, 0x82225f0dUL, 0x9b2b9a07UL, 0x052b30cbUL,
+    0xe62cbf45UL, 0x782c1589UL, 0xd43e3550UL, 0x4a3e9f9cUL, 0xa9391012UL,
+    0x3739badeUL, 0x2e307fd4UL, 0xb030d518UL, 0x53375a96UL, 0xcd37f05aUL,
+    0x4a146bffUL, 0xd414c133UL, 0x37134ebdUL, 0xa913e471UL, 0xb01a217bUL,
+    0x2e1a8bb7UL, 0xcd1d0439UL, 0x531daef5UL, 0xff0f8e2cUL, 0x610f24e0UL,
+    0x8208ab6eUL, 0x1c0801a2UL, 0x0501c4a8UL, 0x9b016e64UL, 0x7806e1eaUL,
+    0xe6064b26UL
 #endif
   }
 };
+
+local const z_crc_t FAR x2n_table[32] = {
+    0x40000000UL, 0x20000000UL, 0x08000000UL, 0x00800000UL, 0x00008000UL,
+    0xedb88320UL, 0xb1e6b092UL, 0xa06a2517UL, 0xed627daeUL, 0x88d14467UL,
+    0xd7bbfe6aUL, 0xec447f11UL, 0x8e7ea170UL, 0x6427800eUL, 0x4d47bae0UL,
+    0x09fe548fUL, 0x83852d0fUL, 0x30362f1aUL, 0x7b5a9cc3UL, 0x31fec169UL,
+    0x9fec022aUL, 0x6c8dedc4UL, 0x15d6874dUL, 0x5fde7a4eUL, 0xbad90e37UL,
+    0x2e4e5eefUL, 0x4eaba214UL, 0xa8a472c0UL, 0x429a969eUL, 0x148d302aUL,
+    0xc40ba6d0UL, 0xc4e22c3cUL
+};
+
+local const z_crc_t FAR crc32c_table[TBLS][256] =
+{
+  {
+    0x00000000UL, 0xf26b8303UL, 0xe13b70f7UL, 0x1350f3f4UL, 0xc79a971fUL,
+    0x35f1141cUL, 0x26a1e7e8UL, 0xd4ca64ebUL, 0x8ad958cfUL, 0x78b2dbccUL,
+    0x6be22838UL, 0x9989ab3bUL, 0x4d43cfd0UL, 0xbf284cd3UL, 0xac78bf27UL,
+    0x5e133c24UL, 0x105ec76fUL, 0xe235446cUL, 0xf165b798UL, 0x030e349bUL,
+    0xd7c45070UL, 0x25afd373UL, 0x36ff2087UL, 0xc494a384UL, 0x9a879fa0UL,
+    0x68ec1ca3UL, 0x7bbcef57UL, 0x89d76c54UL, 0x5d1d08bfUL, 0xaf768bbcUL,
+    0xbc267848UL, 0x4e4dfb4bUL, 0x20bd8edeUL, 0xd2d60dddUL, 0xc186fe29UL,
+    0x33ed7d2aUL, 0xe72719c1UL, 0x154c9ac2UL, 0x061c6936UL, 0xf477ea35UL,
+    0xaa64d611UL, 0x580f5512UL, 0x4b5fa6e6UL, 0xb93425e5UL, 0x6dfe410eUL,
+    0x9f95c20dUL, 0x8cc531f9UL, 0x7eaeb2faUL, 0x30e349b1UL, 0xc288cab2UL,
+    0xd1d83946UL, 0x23b3ba45UL, 0xf779deaeUL, 0x05125dadUL, 0x1642ae59UL,
+    0xe4292d5aUL, 0xba3a117eUL, 0x4851927dUL, 0x5b016189UL, 0xa96ae28aUL,
+    0x7da08661UL, 0x8fcb0562UL, 0x9c9bf696UL, 0x6ef07595UL, 0x417b1dbcUL,
+    0xb3109ebfUL, 0xa0406d4bUL, 0x522bee48UL, 0x86e18aa3UL, 0x748a09a0UL,
+    0x67dafa54UL, 0x95b17957UL, 0xcba24573UL, 0x39c9c670UL, 0x2a993584UL,
+    0xd8f2b687UL, 0x0c38d26cUL, 0xfe53516fUL, 0xed03a29bUL, 0x1f682198UL,
+    0x5125dad3UL, 0xa34e59d0UL, 0xb01eaa24UL, 0x42752927UL, 0x96bf4dccUL,
+    0x64d4cecfUL, 0x77843d3bUL, 0x85efbe38UL, 0xdbfc821cUL, 0x2997011fUL,
+    0x3ac7f2ebUL, 0xc8ac71e8UL, 0x1c661503UL, 0xee0d9600UL, 0xfd5d65f4UL,
+    0x0f36e6f7UL, 0x61c69362UL, 0x93ad1061UL, 0x80fde395UL, 0x72966096UL,
+    0xa65c047dUL, 0x5437877eUL, 0x4767748aUL, 0xb50cf789UL, 0xeb1fcbadUL,
+    0x197448aeUL, 0x0a24bb5aUL, 0xf84f3859UL, 0x2c855cb2UL, 0xdeeedfb1UL,
+    0xcdbe2c45UL, 0x3fd5af46UL, 0x7198540dUL, 0x83f3d70eUL, 0x90a324faUL,
+    0x62c8a7f9UL, 0xb602c312UL, 0x44694011UL, 0x5739b3e5UL, 0xa55230e6UL,
+    0xfb410cc2UL, 0x092a8fc1UL, 0x1a7a7c35UL, 0xe811ff36UL, 0x3cdb9bddUL,
+    0xceb018deUL, 0xdde0eb2aUL, 0x2f8b6829UL, 0x82f63b78UL, 0x709db87bUL,
+    0x63cd4b8fUL, 0x91a6c88cUL, 0x456cac67UL, 0xb7072f64UL, 0xa457dc90UL,
+    0x563c5f93UL, 0x082f63b7UL, 0xfa44e0b4UL, 0xe9141340UL, 0x1b7f9043UL,
+    0xcfb5f4a8UL, 0x3dde77abUL, 0x2e8e845fUL, 0xdce5075cUL, 0x92a8fc17UL,
+    0x60c37f14UL, 0x73938ce0UL, 0x81f80fe3UL, 0x55326b08UL, 0xa759e80bUL,
+    0xb4091bffUL, 0x466298fcUL, 0x1871a4d8UL, 0xea1a27dbUL, 0xf94ad42fUL,
+    0x0b21572cUL, 0xdfeb33c7UL, 0x2d80b0c4UL, 0x3ed04330UL, 0xccbbc033UL,
+    0xa24bb5a6UL, 0x502036a5UL, 0x4370c551UL, 0xb11b4652UL, 0x65d122b9UL,
+    0x97baa1baUL, 0x84ea524eUL, 0x7681d14dUL, 0x2892ed69UL, 0xdaf96e6aUL,
+    0xc9a99d9eUL, 0x3bc21e9dUL, 0xef087a76UL, 0x1d63f975UL, 0x0e330a81UL,
+    0xfc588982UL, 0xb21572c9UL, 0x407ef1caUL, 0x532e023eUL, 0xa145813dUL,
+    0x758fe5d6UL, 0x87e466d5UL, 0x94b49521UL, 0x66df1622UL, 0x38cc2a06UL,
+    0xcaa7a905UL, 0xd9f75af1UL, 0x2b9cd9f2UL, 0xff56bd19UL, 0x0d3d3e1aUL,
+    0x1e6dcdeeUL, 0xec064eedUL, 0xc38d26c4UL, 0x31e6a5c7UL, 0x22b65633UL,
+    0xd0ddd530UL, 0x0417b1dbUL, 0xf67c32d8UL, 0xe52cc12cUL, 0x1747422fUL,
+    0x49547e0bUL, 0xbb3ffd08UL, 0xa86f0efcUL, 0x5a048dffUL, 0x8ecee914UL,
+    0x7ca56a17UL, 0x6ff599e3UL, 0x9d9e1ae0UL, 0xd3d3e1abUL, 0x21b862a8UL,
+    0x32e8915cUL, 0xc083125fUL, 0x144976b4UL, 0xe622f5b7UL, 0xf5720643UL,
+    0x07198540UL, 0x590ab964UL, 0xab613a67UL, 0xb831c993UL, 0x4a5a4a90UL,
+    0x9e902e7bUL, 0x6cfbad78UL, 0x7fab5e8cUL, 0x8dc0dd8fUL, 0xe330a81aUL,
+    0x115b2b19UL, 0x020bd8edUL, 0xf0605beeUL, 0x24aa3f05UL, 0xd6c1bc06UL,
+    0xc5914ff2UL, 0x37faccf1UL, 0x69e9f0d5UL, 0x9b8273d6UL, 0x88d28022UL,
+    0x7ab90321UL, 0xae7367caUL, 0x5c18e4c9UL, 0x4f48173dUL, 0xbd23943eUL,
+    0xf36e6f75UL, 0x0105ec76UL, 0x12551f82UL, 0xe03e9c81UL, 0x34f4f86aUL,
+    0xc69f7b69UL, 0xd5cf889dUL, 0x27a40b9eUL, 0x79b737baUL, 0x8bdcb4b9UL,
+    0x988c474dUL, 0x6ae7c44eUL, 0xbe2da0a5UL, 0x4c4623a6UL, 0x5f16d052UL,
+    0xad7d5351UL
+#ifdef BYFOUR
+  },
+  {
+    0x00000000UL, 0x13a29877UL, 0x274530eeUL, 0x34e7a899UL, 0x4e8a61dcUL,
+    0x5d28f9abUL, 0x69cf5132UL, 0x7a6dc945UL, 0x9d14c3b8UL, 0x8eb65bcfUL,
+    0xba51f356UL, 0xa9f36b21UL, 0xd39ea264UL, 0xc03c3a13UL, 0xf4db928aUL,
+    0xe7790afdUL, 0x3fc5f181UL, 0x2c6769f6UL, 0x1880c16fUL, 0x0b225918UL,
+    0x714f905dUL, 0x62ed082aUL, 0x560aa0b3UL, 0x45a838c4UL, 0xa2d13239UL,
+    0xb173aa4eUL, 0x859402d7UL, 0x96369aa0UL, 0xec5b53e5UL, 0xfff9cb92UL,
+    0xcb1e630bUL, 0xd8bcfb7cUL, 0x7f8be302UL, 0x6c297b75UL, 0x58ced3ecUL,
+    0x4b6c4b9bUL, 0x310182deUL, 0x22a31aa9UL, 0x1644b230UL, 0x05e62a47UL,
+    0xe29f20baUL, 0xf13db8cdUL, 0xc5da1054UL, 0xd6788823UL, 0xac154166UL,
+    0xbfb7d911UL, 0x8b507188UL, 0x98f2e9ffUL, 0x404e1283UL, 0x53ec8af4UL,
+    0x670b226dUL, 0x74a9ba1aUL, 0x0ec4735fUL, 0x1d66eb28UL, 0x298143b1UL,
+    0x3a23dbc6UL, 0xdd5ad13bUL, 0xcef8494cUL, 0xfa1fe1d5UL, 0xe9bd79a2UL,
+    0x93d0b0e7UL, 0x80722890UL, 0xb4958009UL, 0xa737187eUL, 0xff17c604UL,
+    0xecb55e73UL, 0xd852f6eaUL, 0xcbf06e9dUL, 0xb19da7d8UL, 0xa23f3fafUL,
+    0x96d89736UL, 0x857a0f41UL, 0x620305bcUL, 0x71a19dcbUL, 0x45463552UL,
+    0x56e4ad25UL, 0x2c896460UL, 0x3f2bfc17UL, 0x0bcc548eUL, 0x186eccf9UL,
+    0xc0d23785UL, 0xd370aff2UL, 0xe797076bUL, 0xf4359f1cUL, 0x8e585659UL,
+    0x9dface2eUL, 0xa91d66b7UL, 0xbabffec0UL, 0x5dc6f43dUL, 0x4e646c4aUL,
+    0x7a83c4d3UL, 0x69215ca4UL, 0x134c95e1UL, 0x00ee0d96UL, 0x3409a50fUL,
+    0x27ab3d78UL, 0x809c2506UL, 0x933ebd71UL, 0xa7d915e8UL, 0xb47b8d9fUL,
+    0xce1644daUL, 0xddb4dcadUL, 0xe9537434UL, 0xfaf1ec43UL, 0x1d88e6beUL,
+    0x0e2a7ec9UL, 0x3acdd650UL, 0x296f4e27UL, 0x53028762UL, 0x40a01f15UL,
+    0x7447b78cUL, 0x67e52ffbUL, 0xbf59d487UL, 0xacfb4cf0UL, 0x981ce469UL,
+    0x8bbe7c1eUL, 0xf1d3b55bUL, 0xe2712d2cUL, 0xd69685b5UL, 0xc5341dc2UL,
+    0x224d173fUL, 0x31ef8f48UL, 0x050827d1UL, 0x16aabfa6UL, 0x6cc776e3UL,
+    0x7f65ee94UL, 0x4b82460dUL, 0x5820de7aUL, 0xfbc3faf9UL, 0xe861628eUL,
+    0xdc86ca17UL, 0xcf245260UL, 0xb5499b25UL, 0xa6eb0352UL, 0x920cabcbUL,
+    0x81ae33bcUL, 0x66d73941UL, 0x7575a136UL, 0x419209afUL, 0x523091d8UL,
+    0x285d589dUL, 0x3bffc0eaUL, 0x0f186873UL, 0x1cbaf004UL, 0xc4060b78UL,
+    0xd7a4930fUL, 0xe3433b96UL, 0xf0e1a3e1UL, 0x8a8c6aa4UL, 0x992ef2d3UL,
+    0xadc95a4aUL, 0xbe6bc23dUL, 0x5912c8c0UL, 0x4ab050b7UL, 0x7e57f82eUL,
+    0x6df56059UL, 0x1798a91cUL, 0x043a316bUL, 0x30dd99f2UL, 0x237f0185UL,
+    0x844819fbUL, 0x97ea818cUL, 0xa30d2915UL, 0xb0afb162UL, 0xcac27827UL,
+    0xd960e050UL, 0xed8748c9UL, 0xfe25d0beUL, 0x195cda43UL, 0x0afe4234UL,
+    0x3e19eaadUL, 0x2dbb72daUL, 0x57d6bb9fUL, 0x447423e8UL, 0x70938b71UL,
+    0x63311306UL, 0xbb8de87aUL, 0xa82f700dUL, 0x9cc8d894UL, 0x8f6a40e3UL,
+    0xf50789a6UL, 0xe6a511d1UL, 0xd242b948UL, 0xc1e0213fUL, 0x26992bc2UL,
+    0x353bb3b5UL, 0x01dc1b2cUL, 0x127e835bUL, 0x68134a1eUL, 0x7bb1d269UL,
+    0x4f567af0UL, 0x5cf4e287UL, 0x04d43cfdUL, 0x1776a48aUL, 0x23910c13UL,
+    0x30339464UL, 0x4a5e5d21UL, 0x59fcc556UL, 0x6d1b6dcfUL, 0x7eb9f5b8UL,
+    0x99c0ff45UL, 0x8a626732UL, 0xbe85cfabUL, 0xad2757dcUL, 0xd74a9e99UL,
+    0xc4e806eeUL, 0xf00fae77UL, 0xe3ad3600UL, 0x3b11cd7cUL, 0x28b3550bUL,
+    0x1c54fd92UL, 0x0ff665e5UL, 0x759baca0UL, 0x663934d7UL, 0x52de9c4eUL,
+    0x417c0439UL, 0xa6050ec4UL, 0xb5a796b3UL, 0x81403e2aUL, 0x92e2a65dUL,
+    0xe88f6f18UL, 0xfb2df76fUL, 0xcfca5ff6UL, 0xdc68c781UL, 0x7b5fdfffUL,
+    0x68fd4788UL, 0x5c1aef11UL, 0x4fb87766UL, 0x35d5be23UL, 0x26772654UL,
+    0x12908ecdUL, 0x013216baUL, 0xe64b1c47UL, 0xf5e98430UL, 0xc10e2ca9UL,
+    0xd2acb4deUL, 0xa8c17d9bUL, 0xbb63e5ecUL, 0x8f844d75UL, 0x9c26d502UL,
+    0x449a2e7eUL, 0x5738b609UL, 0x63df1e90UL, 0x707d86e7UL, 0x0a104fa2UL,
+    0x19b2d7d5UL, 0x2d557f4cUL, 0x3ef7e73bUL, 0xd98eedc6UL, 0xca2c75b1UL,
+    0xfecbdd28UL, 0xed69455fUL, 0x97048c1aUL, 0x84a6146dUL, 0xb041bcf4UL,
+    0xa3e32483UL
+  },
+  {
+    0x00000000UL, 0xa541927eUL, 0x4f6f520dUL, 0xea2ec073UL, 0x9edea41aUL,
+    0x3b9f3664UL, 0xd1b1f617UL, 0x74f06469UL, 0x38513ec5UL, 0x9d10acbbUL,
+    0x773e6cc8UL, 0xd27ffeb6UL, 0xa68f9adfUL, 0x03ce08a1UL, 0xe9e0c8d2UL,
+    0x4ca15aacUL, 0x70a27d8aUL, 0xd5e3eff4UL, 0x3fcd2f87UL, 0x9a8cbdf9UL,
+    0xee7cd990UL, 0x4b3d4beeUL, 0xa1138b9dUL, 0x045219e3UL, 0x48f3434fUL,
+    0xedb2d131UL, 0x079c1142UL, 0xa2dd833cUL, 0xd62de755UL, 0x736c752bUL,
+    0x9942b558UL, 0x3c032726UL, 0xe144fb14UL, 0x4405696aUL, 0xae2ba919UL,
+    0x0b6a3b67UL, 0x7f9a5f0eUL, 0xdadbcd70UL, 0x30f50d03UL, 0x95b49f7dUL,
+    0xd915c5d1UL, 0x7c5457afUL, 0x967a97dcUL, 0x333b05a2UL, 0x47cb61cbUL,
+    0xe28af3b5UL, 0x08a433c6UL, 0xade5a1b8UL, 0x91e6869eUL, 0x34a714e0UL,
+    0xde89d493UL, 0x7bc846edUL, 0x0f382284UL, 0xaa79b0faUL, 0x40577089UL,
+    0xe516e2f7UL, 0xa9b7b85bUL, 0x0cf62a25UL, 0xe6d8ea56UL, 0x43997828UL,
+    0x37691c41UL, 0x92288e3fUL, 0x78064e4cUL, 0xdd47dc32UL, 0xc76580d9UL,
+    0x622412a7UL, 0x880ad2d4UL, 0x2d4b40aaUL, 0x59bb24c3UL, 0xfcfab6bdUL,
+    0x16d476ceUL, 0xb395e4b0UL, 0xff34be1cUL, 0x5a752c62UL, 0xb05bec11UL,
+    0x151a7e6fUL, 0x61ea1a06UL, 0xc4ab8878UL, 0x2e85480bUL, 0x8bc4da75UL,
+    0xb7c7fd53UL, 0x12866f2dUL, 0xf8a8af5eUL, 0x5de93d20UL, 0x29195949UL,
+    0x8c58cb37UL, 0x66760b44UL, 0xc337993aUL, 0x8f96c396UL, 0x2ad751e8UL,
+    0xc0f9919bUL, 0x65b803e5UL, 0x1148678cUL, 0xb409f5f2UL, 0x5e273581UL,
+    0xfb66a7ffUL, 0x26217bcdUL, 0x8360e9b3UL, 0x694e29c0UL, 0xcc0fbbbeUL,
+    0xb8ffdfd7UL, 0x1dbe4da9UL, 0xf7908ddaUL, 0x52d11fa4UL, 0x1e704508UL,
+    0xbb31d776UL, 0x511f1705UL, 0xf45e857bUL, 0x80aee112UL, 0x25ef736cUL,
+    0xcfc1b31fUL, 0x6a802161UL, 0x56830647UL, 0xf3c29439UL, 0x19ec544aUL,
+    0xbcadc634UL, 0xc85da25dUL, 0x6d1c3023UL, 0x8732f050UL, 0x2273622eUL,
+    0x6ed23882UL, 0xcb93aafcUL, 0x21bd6a8fUL, 0x84fcf8f1UL, 0xf00c9c98UL,
+    0x554d0ee6UL, 0xbf63ce95UL, 0x1a225cebUL, 0x8b277743UL, 0x2e66e53dUL,
+    0xc448254eUL, 0x6109b730UL, 0x15f9d359UL, 0xb0b84127UL, 0x5a968154UL,
+    0xffd7132aUL, 0xb3764986UL, 0x1637dbf8UL, 0xfc191b8bUL, 0x595889f5UL,
+    0x2da8ed9cUL, 0x88e97fe2UL, 0x62c7bf91UL, 0xc7862defUL, 0xfb850ac9UL,
+    0x5ec498b7UL, 0xb4ea58c4UL, 0x11abcabaUL, 0x655baed3UL, 0xc01a3cadUL,
+    0x2a34fcdeUL, 0x8f756ea0UL, 0xc3d4340cUL, 0x6695a672UL, 0x8cbb6601UL,
+    0x29faf47fUL, 0x5d0a9016UL, 0xf84b0268UL, 0x1265c21bUL, 0xb7245065UL,
+    0x6a638c57UL, 0xcf221e29UL, 0x250cde5aUL, 0x804d4c24UL, 0xf4bd284dUL,
+    0x51fcba33UL, 0xbbd27a40UL, 0x1e93e83eUL, 0x5232b292UL, 0xf77320ecUL,
+    0x1d5de09fUL, 0xb81c72e1UL, 0xccec1688UL, 0x69ad84f6UL, 0x83834485UL,
+    0x26c2d6fbUL, 0x1ac1f1ddUL, 0xbf8063a3UL, 0x55aea3d0UL, 0xf0ef31aeUL,
+    0x841f55c7UL, 0x215ec7b9UL, 0xcb7007caUL, 0x6e3195b4UL, 0x2290cf18UL,
+    0x87d15d66UL, 0x6dff9d15UL, 0xc8be0f6bUL, 0xbc4e6b02UL, 0x190ff97cUL,
+    0xf321390fUL, 0x5660ab71UL, 0x4c42f79aUL, 0xe90365e4UL, 0x032da597UL,
+    0xa66c37e9UL, 0xd29c5380UL, 0x77ddc1feUL, 0x9df3018dUL, 0x38b293f3UL,
+    0x7413c95fUL, 0xd1525b21UL, 0x3b7c9b52UL, 0x9e3d092cUL, 0xeacd6d45UL,
+    0x4f8cff3bUL, 0xa5a23f48UL, 0x00e3ad36UL, 0x3ce08a10UL, 0x99a1186eUL,
+    0x738fd81dUL, 0xd6ce4a63UL, 0xa23e2e0aUL, 0x077fbc74UL, 0xed517c07UL,
+    0x4810ee79UL, 0x04b1b4d5UL, 0xa1f026abUL, 0x4bdee6d8UL, 0xee9f74a6UL,
+    0x9a6f10cfUL, 0x3f2e82b1UL, 0xd50042c2UL, 0x7041d0bcUL, 0xad060c8eUL,
+    0x08479ef0UL, 0xe2695e83UL, 0x4728ccfdUL, 0x33d8a894UL, 0x96993aeaUL,
+    0x7cb7fa99UL, 0xd9f668e7UL, 0x9557324bUL, 0x3016a035UL, 0xda386046UL,
+    0x7f79f238UL, 0x0b899651UL, 0xaec8042fUL, 0x44e6c45cUL, 0xe1a75622UL,
+    0xdda47104UL, 0x78e5e37aUL, 0x92cb2309UL, 0x378ab177UL, 0x437ad51eUL,
+    0xe63b4760UL, 0x0c158713UL, 0xa954156dUL, 0xe5f54fc1UL, 0x40b4ddbfUL,
+    0xaa9a1dccUL, 0x0fdb8fb2UL, 0x7b2bebdbUL, 0xde6a79a5UL, 0x3444b9d6UL,
+    0x91052ba8UL
+  },
+  {
+    0x00000000UL, 0xdd45aab8UL, 0xbf672381UL, 0x62228939UL, 0x7b2231f3UL,
+    0xa6679b4bUL, 0xc4451272UL, 0x1900b8caUL, 0xf64463e6UL, 0x2b01c95eUL,
+    0x49234067UL, 0x9466eadfUL, 0x8d665215UL, 0x5023f8adUL, 0x32017194UL,
+    0xef44db2cUL, 0xe964b13dUL, 0x34211b85UL, 0x560392bcUL, 0x8b463804UL,
+    0x924680ceUL, 0x4f032a76UL, 0x2d21a34fUL, 0xf06409f7UL, 0x1f20d2dbUL,
+    0xc2657863UL, 0xa047f15aUL, 0x7d025be2UL, 0x6402e328UL, 0xb9474990UL,
+    0xdb65c0a9UL, 0x06206a11UL, 0xd725148bUL, 0x0a60be33UL, 0x6842370aUL,
+    0xb5079db2UL, 0xac072578UL, 0x71428fc0UL, 0x136006f9UL, 0xce25ac41UL,
+    0x2161776dUL, 0xfc24ddd5UL, 0x9e0654ecUL, 0x4343fe54UL, 0x5a43469eUL,
+    0x8706ec26UL, 0xe524651fUL, 0x3861cfa7UL, 0x3e41a5b6UL, 0xe3040f0eUL,
+    0x81268637UL, 0x5c632c8fUL, 0x45639445UL, 0x98263efdUL, 0xfa04b7c4UL,
+    0x27411d7cUL, 0xc805c650UL, 0x15406ce8UL, 0x7762e5d1UL, 0xaa274f69UL,
+    0xb327f7a3UL, 0x6e625d1bUL, 0x0c40d422UL, 0xd1057e9aUL, 0xaba65fe7UL,
+    0x76e3f55fUL, 0x14c17c66UL, 0xc984d6deUL, 0xd0846e14UL, 0x0dc1c4acUL,
+    0x6fe34d95UL, 0xb2a6e72dUL, 0x5de23c01UL, 0x80a796b9UL, 0xe2851f80UL,
+    0x3fc0b538UL, 0x26c00df2UL, 0xfb85a74aUL, 0x99a72e73UL, 0x44e284cbUL,
+    0x42c2eedaUL, 0x9f874462UL, 0xfda5cd5bUL, 0x20e067e3UL, 0x39e0df29UL,
+    0xe4a57591UL, 0x8687fca8UL, 0x5bc25610UL, 0xb4868d3cUL, 0x69c32784UL,
+    0x0be1aebdUL, 0xd6a40405UL, 0xcfa4bccfUL, 0x12e11677UL, 0x70c39f4eUL,
+    0xad8635f6UL, 0x7c834b6cUL, 0xa1c6e1d4UL, 0xc3e468edUL, 0x1ea1c255UL,
+    0x07a17a9fUL, 0xdae4d027UL, 0xb8c6591eUL, 0x6583f3a6UL, 0x8ac7288aUL,
+    0x57828232UL, 0x35a00b0bUL, 0xe8e5a1b3UL, 0xf1e51979UL, 0x2ca0b3c1UL,
+    0x4e823af8UL, 0x93c79040UL, 0x95e7fa51UL, 0x48a250e9UL, 0x2a80d9d0UL,
+    0xf7c57368UL, 0xeec5cba2UL, 0x3380611aUL, 0x51a2e823UL, 0x8ce7429bUL,
+    0x63a399b7UL, 0xbee6330fUL, 0xdcc4ba36UL, 0x0181108eUL, 0x1881a844UL,
+    0xc5c402fcUL, 0xa7e68bc5UL, 0x7aa3217dUL, 0x52a0c93fUL, 0x8fe56387UL,
+    0xedc7eabeUL, 0x30824006UL, 0x2982f8ccUL, 0xf4c75274UL, 0x96e5db4dUL,
+    0x4ba071f5UL, 0xa4e4aad9UL, 0x79a10061UL, 0x1b838958UL, 0xc6c623e0UL,
+    0xdfc69b2aUL, 0x02833192UL, 0x60a1b8abUL, 0xbde41213UL, 0xbbc47802UL,
+    0x6681d2baUL, 0x04a35b83UL, 0xd9e6f13bUL, 0xc0e649f1UL, 0x1da3e349UL,
+    0x7f816a70UL, 0xa2c4c0c8UL, 0x4d801be4UL, 0x90c5b15cUL, 0xf2e73865UL,
+    0x2fa292ddUL, 0x36a22a17UL, 0xebe780afUL, 0x89c50996UL, 0x5480a32eUL,
+    0x8585ddb4UL, 0x58c0770cUL, 0x3ae2fe35UL, 0xe7a7548dUL, 0xfea7ec47UL,
+    0x23e246ffUL, 0x41c0cfc6UL, 0x9c85657eUL, 0x73c1be52UL, 0xae8414eaUL,
+    0xcca69dd3UL, 0x11e3376bUL, 0x08e38fa1UL, 0xd5a62519UL, 0xb784ac20UL,
+    0x6ac10698UL, 0x6ce16c89UL, 0xb1a4c631UL, 0xd3864f08UL, 0x0ec3e5b0UL,
+    0x17c35d7aUL, 0xca86f7c2UL, 0xa8a47efbUL, 0x75e1d443UL, 0x9aa50f6fUL,
+    0x47e0a5d7UL, 0x25c22ceeUL, 0xf8878656UL, 0xe1873e9cUL, 0x3cc29424UL,
+    0x5ee01d1dUL, 0x83a5b7a5UL, 0xf90696d8UL, 0x24433c60UL, 0x4661b559UL,
+    0x9b241fe1UL, 0x8224a72bUL, 0x5f610d93UL, 0x3d4384aaUL, 0xe0062e12UL,
+    0x0f42f53eUL, 0xd2075f86UL, 0xb025d6bfUL, 0x6d607c07UL, 0x7460c4cdUL,
+    0xa9256e75UL, 0xcb07e74cUL, 0x16424df4UL, 0x106227e5UL, 0xcd278d5dUL,
+    0xaf050464UL, 0x7240aedcUL, 0x6b401616UL, 0xb605bcaeUL, 0xd4273597UL,
+    0x09629f2fUL, 0xe6264403UL, 0x3b63eebbUL, 0x59416782UL, 0x8404cd3aUL,
+    0x9d0475f0UL, 0x4041df48UL, 0x22635671UL, 0xff26fcc9UL, 0x2e238253UL,
+    0xf36628ebUL, 0x9144a1d2UL, 0x4c010b6aUL, 0x5501b3a0UL, 0x88441918UL,
+    0xea669021UL, 0x37233a99UL, 0xd867e1b5UL, 0x05224b0dUL, 0x6700c234UL,
+    0xba45688cUL, 0xa345d046UL, 0x7e007afeUL, 0x1c22f3c7UL, 0xc167597fUL,
+    0xc747336eUL, 0x1a0299d6UL, 0x782010efUL, 0xa565ba57UL, 0xbc65029dUL,
+    0x6120a825UL, 0x0302211cUL, 0xde478ba4UL, 0x31035088UL, 0xec46fa30UL,
+    0x8e647309UL, 0x5321d9b1UL, 0x4a21617bUL, 0x9764cbc3UL, 0xf54642faUL,
+    0x2803e842UL
+  },
+  {
+    0x00000000UL, 0x38116facUL, 0x7022df58UL, 0x4833b0f4UL, 0xe045beb0UL,
+    0xd854d11cUL, 0x906761e8UL, 0xa8760e44UL, 0xc5670b91UL, 0xfd76643dUL,
+    0xb545d4c9UL, 0x8d54bb65UL, 0x2522b521UL, 0x1d33da8dUL, 0x55006a79UL,
+    0x6d1105d5UL, 0x8f2261d3UL, 0xb7330e7fUL, 0xff00be8bUL, 0xc711d127UL,
+    0x6f67df63UL, 0x5776b0cfUL, 0x1f45003bUL, 0x27546f97UL, 0x4a456a42UL,
+    0x725405eeUL, 0x3a67b51aUL, 0x0276dab6UL, 0xaa00d4f2UL, 0x9211bb5eUL,
+    0xda220baaUL, 0xe2336406UL, 0x1ba8b557UL, 0x23b9dafbUL, 0x6b8a6a0fUL,
+    0x539b05a3UL, 0xfbed0be7UL, 0xc3fc644bUL, 0x8bcfd4bfUL, 0xb3debb13UL,
+    0xdecfbec6UL, 0xe6ded16aUL, 0xaeed619eUL, 0x96fc0e32UL, 0x3e8a0076UL,
+    0x069b6fdaUL, 0x4ea8df2eUL, 0x76b9b082UL, 0x948ad484UL, 0xac9bbb28UL,
+    0xe4a80bdcUL, 0xdcb96470UL, 0x74cf6a34UL, 0x4cde0598UL, 0x04edb56cUL,
+    0x3cfcdac0UL, 0x51eddf15UL, 0x69fcb0b9UL, 0x21cf004dUL, 0x19de6fe1UL,
+    0xb1a861a5UL, 0x89b90e09UL, 0xc18abefdUL, 0xf99bd151UL, 0x37516aaeUL,
+    0x0f400502UL, 0x4773b5f6UL, 0x7f62da5aUL, 0xd714d41eUL, 0xef05bbb2UL,
+    0xa7360b46UL, 0x9f2764eaUL, 0xf236613fUL, 0xca270e93UL, 0x8214be67UL,
+    0xba05d1cbUL, 0x1273df8fUL, 0x2a62b023UL, 0x625100d7UL, 0x5a406f7bUL,
+    0xb8730b7dUL, 0x806264d1UL, 0xc851d425UL, 0xf040bb89UL, 0x5836b5cdUL,
+    0x6027da61UL, 0x28146a95UL, 0x10050539UL, 0x7d1400ecUL, 0x45056f40UL,
+    0x0d36dfb4UL, 0x3527b018UL, 0x9d51be5cUL, 0xa540d1f0UL, 0xed736104UL,
+    0xd5620ea8UL, 0x2cf9dff9UL, 0x14e8b055UL, 0x5cdb00a1UL, 0x64ca6f0dUL,
+    0xccbc6149UL, 0xf4ad0ee5UL, 0xbc9ebe11UL, 0x848fd1bdUL, 0xe99ed468UL,
+    0xd18fbbc4UL, 0x99bc0b30UL, 0xa1ad649cUL, 0x09db6ad8UL, 0x31ca0574UL,
+    0x79f9b580UL, 0x41e8da2cUL, 0xa3dbbe2aUL, 0x9bcad186UL, 0xd3f96172UL,
+    0xebe80edeUL, 0x439e009aUL, 0x7b8f6f36UL, 0x33bcdfc2UL, 0x0badb06eUL,
+    0x66bcb5bbUL, 0x5eadda17UL, 0x169e6ae3UL, 0x2e8f054fUL, 0x86f90b0bUL,
+    0xbee864a7UL, 0xf6dbd453UL, 0xcecabbffUL, 0x6ea2d55cUL, 0x56b3baf0UL,
+    0x1e800a04UL, 0x269165a8UL, 0x8ee76becUL, 0xb6f60440UL, 0xfec5b4b4UL,
+    0xc6d4db18UL, 0xabc5decdUL, 0x93d4b161UL, 0xdbe70195UL, 0xe3f66e39UL,
+    0x4b80607dUL, 0x73910fd1UL, 0x3ba2bf25UL, 0x03b3d089UL, 0xe180b48fUL,
+    0xd991db23UL, 0x91a26bd7UL, 0xa9b3047bUL, 0x01c50a3fUL, 0x39d46593UL,
+    0x71e7d567UL, 0x49f6bacbUL, 0x24e7bf1eUL, 0x1cf6d0b2UL, 0x54c56046UL,
+    0x6cd40feaUL, 0xc4a201aeUL, 0xfcb36e02UL, 0xb480def6UL, 0x8c91b15aUL,
+    0x750a600bUL, 0x4d1b0fa7UL, 0x0528bf53UL, 0x3d39d0ffUL, 0x954fdebbUL,
+    0xad5eb117UL, 0xe56d01e3UL, 0xdd7c6e4fUL, 0xb06d6b9aUL, 0x887c0436UL,
+    0xc04fb4c2UL, 0xf85edb6eUL, 0x5028d52aUL, 0x6839ba86UL, 0x200a0a72UL,
+    0x181b65deUL, 0xfa2801d8UL, 0xc2396e74UL, 0x8a0ade80UL, 0xb21bb12cUL,
+    0x1a6dbf68UL, 0x227cd0c4UL, 0x6a4f6030UL, 0x525e0f9cUL, 0x3f4f0a49UL,
+    0x075e65e5UL, 0x4f6dd511UL, 0x777cbabdUL, 0xdf0ab4f9UL, 0xe71bdb55UL,
+    0xaf286ba1UL, 0x9739040dUL, 0x59f3bff2UL, 0x61e2d05eUL, 0x29d160aaUL,
+    0x11c00f06UL, 0xb9b60142UL, 0x81a76eeeUL, 0xc994de1aUL, 0xf185b1b6UL,
+    0x9c94b463UL, 0xa485dbcfUL, 0xecb66b3bUL, 0xd4a70497UL, 0x7cd10ad3UL,
+    0x44c0657fUL, 0x0cf3d58bUL, 0x34e2ba27UL, 0xd6d1de21UL, 0xeec0b18dUL,
+    0xa6f30179UL, 0x9ee26ed5UL, 0x36946091UL, 0x0e850f3dUL, 0x46b6bfc9UL,
+    0x7ea7d065UL, 0x13b6d5b0UL, 0x2ba7ba1cUL, 0x63940ae8UL, 0x5b856544UL,
+    0xf3f36b00UL, 0xcbe204acUL, 0x83d1b458UL, 0xbbc0dbf4UL, 0x425b0aa5UL,
+    0x7a4a6509UL, 0x3279d5fdUL, 0x0a68ba51UL, 0xa21eb415UL, 0x9a0fdbb9UL,
+    0xd23c6b4dUL, 0xea2d04e1UL, 0x873c0134UL, 0xbf2d6e98UL, 0xf71ede6cUL,
+    0xcf0fb1c0UL, 0x6779bf84UL, 0x5f68d028UL, 0x175b60dcUL, 0x2f4a0f70UL,
+    0xcd796b76UL, 0xf56804daUL, 0xbd5bb42eUL, 0x854adb82UL, 0x2d3cd5c6UL,
+    0x152dba6aUL, 0x5d1e0a9eUL, 0x650f6532UL, 0x081e60e7UL, 0x300f0f4bUL,
+    0x783cbfbfUL, 0x402dd013UL, 0xe85bde57UL, 0xd04ab1fbUL, 0x9879010fUL,
+    0xa0686ea3UL
+  },
+  {
+    0x00000000UL, 0xef306b19UL, 0xdb8ca0c3UL, 0x34bccbdaUL, 0xb2f53777UL,
+    0x5dc55c6eUL, 0x697997b4UL, 0x8649fcadUL, 0x6006181fUL, 0x8f367306UL,
+    0xbb8ab8dcUL, 0x54bad3c5UL, 0xd2f32f68UL, 0x3dc34471UL, 0x097f8fabUL,
+    0xe64fe4b2UL, 0xc00c303eUL, 0x2f3c5b27UL, 0x1b8090fdUL, 0xf4b0fbe4UL,
+    0x72f90749UL, 0x9dc96c50UL, 0xa975a78aUL, 0x4645cc93UL, 0xa00a2821UL,
+    0x4f3a4338UL, 0x7b8688e2UL, 0x94b6e3fbUL, 0x12ff1f56UL, 0xfdcf744fUL,
+    0xc973bf95UL, 0x2643d48cUL, 0x85f4168dUL, 0x6ac47d94UL, 0x5e78b64eUL,
+    0xb148dd57UL, 0x370121faUL, 0xd8314ae3UL, 0xec8d8139UL, 0x03bdea20UL,
+    0xe5f20e92UL, 0x0ac2658bUL, 0x3e7eae51UL, 0xd14ec548UL, 0x570739e5UL,
+    0xb83752fcUL, 0x8c8b9926UL, 0x63bbf23fUL, 0x45f826b3UL, 0xaac84daaUL,
+    0x9e748670UL, 0x7144ed69UL, 0xf70d11c4UL, 0x183d7addUL, 0x2c81b107UL,
+    0xc3b1da1eUL, 0x25fe3eacUL, 0xcace55b5UL, 0xfe729e6fUL, 0x1142f576UL,
+    0x970b09dbUL, 0x783b62c2UL, 0x4c87a918UL, 0xa3b7c201UL, 0x0e045bebUL,
+    0xe13430f2UL, 0xd588fb28UL, 0x3ab89031UL, 0xbcf16c9cUL, 0x53c10785UL,
+    0x677dcc5fUL, 0x884da746UL, 0x6e0243f4UL, 0x813228edUL, 0xb58ee337UL,
+    0x5abe882eUL, 0xdcf77483UL, 0x33c71f9aUL, 0x077bd440UL, 0xe84bbf59UL,
+    0xce086bd5UL, 0x213800ccUL, 0x1584cb16UL, 0xfab4a00fUL, 0x7cfd5ca2UL,
+    0x93cd37bbUL, 0xa771fc61UL, 0x48419778UL, 0xae0e73caUL, 0x413e18d3UL,
+    0x7582d309UL, 0x9ab2b810UL, 0x1cfb44bdUL, 0xf3cb2fa4UL, 0xc777e47eUL,
+    0x28478f67UL, 0x8bf04d66UL, 0x64c0267fUL, 0x507ceda5UL, 0xbf4c86bcUL,
+    0x39057a11UL, 0xd6351108UL, 0xe289dad2UL, 0x0db9b1cbUL, 0xebf65579UL,
+    0x04c63e60UL, 0x307af5baUL, 0xdf4a9ea3UL, 0x5903620eUL, 0xb6330917UL,
+    0x828fc2cdUL, 0x6dbfa9d4UL, 0x4bfc7d58UL, 0xa4cc1641UL, 0x9070dd9bUL,
+    0x7f40b682UL, 0xf9094a2fUL, 0x16392136UL, 0x2285eaecUL, 0xcdb581f5UL,
+    0x2bfa6547UL, 0xc4ca0e5eUL, 0xf076c584UL, 0x1f46ae9dUL, 0x990f5230UL,
+    0x763f3929UL, 0x4283f2f3UL, 0xadb399eaUL, 0x1c08b7d6UL, 0xf338dccfUL,
+    0xc7841715UL, 0x28b47c0cUL, 0xaefd80a1UL, 0x41cdebb8UL, 0x75712062UL,
+    0x9a414b7bUL, 0x7c0eafc9UL, 0x933ec4d0UL, 0xa7820f0aUL, 0x48b26413UL,
+    0xcefb98beUL, 0x21cbf3a7UL, 0x1577387dUL, 0xfa475364UL, 0xdc0487e8UL,
+    0x3334ecf1UL, 0x0788272bUL, 0xe8b84c32UL, 0x6ef1b09fUL, 0x81c1db86UL,
+    0xb57d105cUL, 0x5a4d7b45UL, 0xbc029ff7UL, 0x5332f4eeUL, 0x678e3f34UL,
+    0x88be542dUL, 0x0ef7a880UL, 0xe1c7c399UL, 0xd57b0843UL, 0x3a4b635aUL,
+    0x99fca15bUL, 0x76ccca42UL, 0x42700198UL, 0xad406a81UL, 0x2b09962cUL,
+    0xc439fd35UL, 0xf08536efUL, 0x1fb55df6UL, 0xf9fab944UL, 0x16cad25dUL,
+    0x22761987UL, 0xcd46729eUL, 0x4b0f8e33UL, 0xa43fe52aUL, 0x90832ef0UL,
+    0x7fb345e9UL, 0x59f09165UL, 0xb6c0fa7cUL, 0x827c31a6UL, 0x6d4c5abfUL,
+    0xeb05a612UL, 0x0435cd0bUL, 0x308906d1UL, 0xdfb96dc8UL, 0x39f6897aUL,
+    0xd6c6e263UL, 0xe27a29b9UL, 0x0d4a42a0UL, 0x8b03be0dUL, 0x6433d514UL,
+    0x508f1eceUL, 0xbfbf75d7UL, 0x120cec3dUL, 0xfd3c8724UL, 0xc9804cfeUL,
+    0x26b027e7UL, 0xa0f9db4aUL, 0x4fc9b053UL, 0x7b757b89UL, 0x94451090UL,
+    0x720af422UL, 0x9d3a9f3bUL, 0xa98654e1UL, 0x46b63ff8UL, 0xc0ffc355UL,
+    0x2fcfa84cUL, 0x1b736396UL, 0xf443088fUL, 0xd200dc03UL, 0x3d30b71aUL,
+    0x098c7cc0UL, 0xe6bc17d9UL, 0x60f5eb74UL, 0x8fc5806dUL, 0xbb794bb7UL,
+    0x544920aeUL, 0xb206c41cUL, 0x5d36af05UL, 0x698a64dfUL, 0x86ba0fc6UL,
+    0x00f3f36bUL, 0xefc39872UL, 0xdb7f53a8UL, 0x344f38b1UL, 0x97f8fab0UL,
+    0x78c891a9UL, 0x4c745a73UL, 0xa344316aUL, 0x250dcdc7UL, 0xca3da6deUL,
+    0xfe816d04UL, 0x11b1061dUL, 0xf7fee2afUL, 0x18ce89b6UL, 0x2c72426cUL,
+    0xc3422975UL, 0x450bd5d8UL, 0xaa3bbec1UL, 0x9e87751bUL, 0x71b71e02UL,
+    0x57f4ca8eUL, 0xb8c4a197UL, 0x8c786a4dUL, 0x63480154UL, 0xe501fdf9UL,
+    0x0a3196e0UL, 0x3e8d5d3aUL, 0xd1bd3623UL, 0x37f2d291UL, 0xd8c2b988UL,
+    0xec7e7252UL, 0x034e194bUL, 0x8507e5e6UL, 0x6a378effUL, 0x5e8b4525UL,
+    0xb1bb2e3cUL
+  },
+  {
+    0x00000000UL, 0x68032cc8UL, 0xd0065990UL, 0xb8057558UL, 0xa5e0c5d1UL,
+    0xcde3e919UL, 0x75e69c41UL, 0x1de5b089UL, 0x4e2dfd53UL, 0x262ed19bUL,
+    0x9e2ba4c3UL, 0xf628880bUL, 0xebcd3882UL, 0x83ce144aUL, 0x3bcb6112UL,
+    0x53c84ddaUL, 0x9c5bfaa6UL, 0xf458d66eUL, 0x4c5da336UL, 0x245e8ffeUL,
+    0x39bb3f77UL, 0x51b813bfUL, 0xe9bd66e7UL, 0x81be4a2fUL, 0xd27607f5UL,
+    0xba752b3dUL, 0x02705e65UL, 0x6a7372adUL, 0x7796c224UL, 0x1f95eeecUL,
+    0xa7909bb4UL, 0xcf93b77cUL, 0x3d5b83bdUL, 0x5558af75UL, 0xed5dda2dUL,
+    0x855ef6e5UL, 0x98bb466cUL, 0xf0b86aa4UL, 0x48bd1ffcUL, 0x20be3334UL,
+    0x73767eeeUL, 0x1b755226UL, 0xa370277eUL, 0xcb730bb6UL, 0xd696bb3fUL,
+    0xbe9597f7UL, 0x0690e2afUL, 0x6e93ce67UL, 0xa100791bUL, 0xc90355d3UL,
+    0x7106208bUL, 0x19050c43UL, 0x04e0bccaUL, 0x6ce39002UL, 0xd4e6e55aUL,
+    0xbce5c992UL, 0xef2d8448UL, 0x872ea880UL, 0x3f2bddd8UL, 0x5728f110UL,
+    0x4acd4199UL, 0x22ce6d51UL, 0x9acb1809UL, 0xf2c834c1UL, 0x7ab7077aUL,
+    0x12b42bb2UL, 0xaab15eeaUL, 0xc2b27222UL, 0xdf57c2abUL, 0xb754ee63UL,
+    0x0f519b3bUL, 0x6752b7f3UL, 0x349afa29UL, 0x5c99d6e1UL, 0xe49ca3b9UL,
+    0x8c9f8f71UL, 0x917a3ff8UL, 0xf9791330UL, 0x417c6668UL, 0x297f4aa0UL,
+    0xe6ecfddcUL, 0x8eefd114UL, 0x36eaa44cUL, 0x5ee98884UL, 0x430c380dUL,
+    0x2b0f14c5UL, 0x930a619dUL, 0xfb094d55UL, 0xa8c1008fUL, 0xc0c22c47UL,
+    0x78c7591fUL, 0x10c475d7UL, 0x0d21c55eUL, 0x6522e996UL, 0xdd279cceUL,
+    0xb524b006UL, 0x47ec84c7UL, 0x2fefa80fUL, 0x97eadd57UL, 0xffe9f19fUL,
+    0xe20c4116UL, 0x8a0f6ddeUL, 0x320a1886UL, 0x5a09344eUL, 0x09c17994UL,
+    0x61c2555cUL, 0xd9c72004UL, 0xb1c40cccUL, 0xac21bc45UL, 0xc422908dUL,
+    0x7c27e5d5UL, 0x1424c91dUL, 0xdbb77e61UL, 0xb3b452a9UL, 0x0bb127f1UL,
+    0x63b20b39UL, 0x7e57bbb0UL, 0x16549778UL, 0xae51e220UL, 0xc652cee8UL,
+    0x959a8332UL, 0xfd99affaUL, 0x459cdaa2UL, 0x2d9ff66aUL, 0x307a46e3UL,
+    0x58796a2bUL, 0xe07c1f73UL, 0x887f33bbUL, 0xf56e0ef4UL, 0x9d6d223cUL,
+    0x25685764UL, 0x4d6b7bacUL, 0x508ecb25UL, 0x388de7edUL, 0x808892b5UL,
+    0xe88bbe7dUL, 0xbb43f3a7UL, 0xd340df6fUL, 0x6b45aa37UL, 0x034686ffUL,
+    0x1ea33676UL, 0x76a01abeUL, 0xcea56fe6UL, 0xa6a6432eUL, 0x6935f452UL,
+    0x0136d89aUL, 0xb933adc2UL, 0xd130810aUL, 0xccd53183UL, 0xa4d61d4bUL,
+    0x1cd36813UL, 0x74d044dbUL, 0x27180901UL, 0x4f1b25c9UL, 0xf71e5091UL,
+    0x9f1d7c59UL, 0x82f8ccd0UL, 0xeafbe018UL, 0x52fe9540UL, 0x3afdb988UL,
+    0xc8358d49UL, 0xa036a181UL, 0x1833d4d9UL, 0x7030f811UL, 0x6dd54898UL,
+    0x05d66450UL, 0xbdd31108UL, 0xd5d03dc0UL, 0x8618701aUL, 0xee1b5cd2UL,
+    0x561e298aUL, 0x3e1d0542UL, 0x23f8b5cbUL, 0x4bfb9903UL, 0xf3feec5bUL,
+    0x9bfdc093UL, 0x546e77efUL, 0x3c6d5b27UL, 0x84682e7fUL, 0xec6b02b7UL,
+    0xf18eb23eUL, 0x998d9ef6UL, 0x2188ebaeUL, 0x498bc766UL, 0x1a438abcUL,
+    0x7240a674UL, 0xca45d32cUL, 0xa246ffe4UL, 0xbfa34f6dUL, 0xd7a063a5UL,
+    0x6fa516fdUL, 0x07a63a35UL, 0x8fd9098eUL, 0xe7da2546UL, 0x5fdf501eUL,
+    0x37dc7cd6UL, 0x2a39cc5fUL, 0x423ae097UL, 0xfa3f95cfUL, 0x923cb907UL,
+    0xc1f4f4ddUL, 0xa9f7d815UL, 0x11f2ad4dUL, 0x79f18185UL, 0x6414310cUL,
+    0x0c171dc4UL, 0xb412689cUL, 0xdc114454UL, 0x1382f328UL, 0x7b81dfe0UL,
+    0xc384aab8UL, 0xab878670UL, 0xb66236f9UL, 0xde611a31UL, 0x66646f69UL,
+    0x0e6743a1UL, 0x5daf0e7bUL, 0x35ac22b3UL, 0x8da957ebUL, 0xe5aa7b23UL,
+    0xf84fcbaaUL, 0x904ce762UL, 0x2849923aUL, 0x404abef2UL, 0xb2828a33UL,
+    0xda81a6fbUL, 0x6284d3a3UL, 0x0a87ff6bUL, 0x17624fe2UL, 0x7f61632aUL,
+    0xc7641672UL, 0xaf673abaUL, 0xfcaf7760UL, 0x94ac5ba8UL, 0x2ca92ef0UL,
+    0x44aa0238UL, 0x594fb2b1UL, 0x314c9e79UL, 0x8949eb21UL, 0xe14ac7e9UL,
+    0x2ed97095UL, 0x46da5c5dUL, 0xfedf2905UL, 0x96dc05cdUL, 0x8b39b544UL,
+    0xe33a998cUL, 0x5b3fecd4UL, 0x333cc01cUL, 0x60f48dc6UL, 0x08f7a10eUL,
+    0xb0f2d456UL, 0xd8f1f89eUL, 0xc5144817UL, 0xad1764dfUL, 0x15121187UL,
+    0x7d113d4fUL
+  },
+  {
+    0x00000000UL, 0x493c7d27UL, 0x9278fa4eUL, 0xdb448769UL, 0x211d826dUL,
+    0x6821ff4aUL, 0xb3657823UL, 0xfa590504UL, 0x423b04daUL, 0x0b0779fdUL,
+    0xd043fe94UL, 0x997f83b3UL, 0x632686b7UL, 0x2a1afb90UL, 0xf15e7cf9UL,
+    0xb86201deUL, 0x847609b4UL, 0xcd4a7493UL, 0x160ef3faUL, 0x5f328eddUL,
+    0xa56b8bd9UL, 0xec57f6feUL, 0x37137197UL, 0x7e2f0cb0UL, 0xc64d0d6eUL,
+    0x8f717049UL, 0x5435f720UL, 0x1d098a07UL, 0xe7508f03UL, 0xae6cf224UL,
+    0x7528754dUL, 0x3c14086aUL, 0x0d006599UL, 0x443c18beUL, 0x9f789fd7UL,
+    0xd644e2f0UL, 0x2c1de7f4UL, 0x65219ad3UL, 0xbe651dbaUL, 0xf759609dUL,
+    0x4f3b6143UL, 0x06071c64UL, 0xdd439b0dUL, 0x947fe62aUL, 0x6e26e32eUL,
+    0x271a9e09UL, 0xfc5e1960UL, 0xb5626447UL, 0x89766c2dUL, 0xc04a110aUL,
+    0x1b0e9663UL, 0x5232eb44UL, 0xa86bee40UL, 0xe1579367UL, 0x3a13140eUL,
+    0x732f6929UL, 0xcb4d68f7UL, 0x827115d0UL, 0x593592b9UL, 0x1009ef9eUL,
+    0xea50ea9aUL, 0xa36c97bdUL, 0x782810d4UL, 0x31146df3UL, 0x1a00cb32UL,
+    0x533cb615UL, 0x8878317cUL, 0xc1444c5bUL, 0x3b1d495fUL, 0x72213478UL,
+    0xa965b311UL, 0xe059ce36UL, 0x583bcfe8UL, 0x1107b2cfUL, 0xca4335a6UL,
+    0x837f4881UL, 0x79264d85UL, 0x301a30a2UL, 0xeb5eb7cbUL, 0xa262caecUL,
+    0x9e76c286UL, 0xd74abfa1UL, 0x0c0e38c8UL, 0x453245efUL, 0xbf6b40ebUL,
+    0xf6573dccUL, 0x2d13baa5UL, 0x642fc782UL, 0xdc4dc65cUL, 0x9571bb7bUL,
+    0x4e353c12UL, 0x07094135UL, 0xfd504431UL, 0xb46c3916UL, 0x6f28be7fUL,
+    0x2614c358UL, 0x1700aeabUL, 0x5e3cd38cUL, 0x857854e5UL, 0xcc4429c2UL,
+    0x361d2cc6UL, 0x7f2151e1UL, 0xa465d688UL, 0xed59abafUL, 0x553baa71UL,
+    0x1c07d756UL, 0xc743503fUL, 0x8e7f2d18UL, 0x7426281cUL, 0x3d1a553bUL,
+    0xe65ed252UL, 0xaf62af75UL, 0x9376a71fUL, 0xda4ada38UL, 0x010e5d51UL,
+    0x48322076UL, 0xb26b2572UL, 0xfb575855UL, 0x2013df3cUL, 0x692fa21bUL,
+    0xd14da3c5UL, 0x9871dee2UL, 0x4335598bUL, 0x0a0924acUL, 0xf05021a8UL,
+    0xb96c5c8fUL, 0x6228dbe6UL, 0x2b14a6c1UL, 0x34019664UL, 0x7d3deb43UL,
+    0xa6796c2aUL, 0xef45110dUL, 0x151c1409UL, 0x5c20692eUL, 0x8764ee47UL,
+    0xce589360UL, 0x763a92beUL, 0x3f06ef99UL, 0xe44268f0UL, 0xad7e15d7UL,
+    0x572710d3UL, 0x1e1b6df4UL, 0xc55fea9dUL, 0x8c6397baUL, 0xb0779fd0UL,
+    0xf94be2f7UL, 0x220f659eUL, 0x6b3318b9UL, 0x916a1dbdUL, 0xd856609aUL,
+    0x0312e7f3UL, 0x4a2e9ad4UL, 0xf24c9b0aUL, 0xbb70e62dUL, 0x60346144UL,
+    0x29081c63UL, 0xd3511967UL, 0x9a6d6440UL, 0x4129e329UL, 0x08159e0eUL,
+    0x3901f3fdUL, 0x703d8edaUL, 0xab7909b3UL, 0xe2457494UL, 0x181c7190UL,
+    0x51200cb7UL, 0x8a648bdeUL, 0xc358f6f9UL, 0x7b3af727UL, 0x32068a00UL,
+    0xe9420d69UL, 0xa07e704eUL, 0x5a27754aUL, 0x131b086dUL, 0xc85f8f04UL,
+    0x8163f223UL, 0xbd77fa49UL, 0xf44b876eUL, 0x2f0f0007UL, 0x66337d20UL,
+    0x9c6a7824UL, 0xd5560503UL, 0x0e12826aUL, 0x472eff4dUL, 0xff4cfe93UL,
+    0xb67083b4UL, 0x6d3404ddUL, 0x240879faUL, 0xde517cfeUL, 0x976d01d9UL,
+    0x4c2986b0UL, 0x0515fb97UL, 0x2e015d56UL, 0x673d2071UL, 0xbc79a718UL,
+    0xf545da3fUL, 0x0f1cdf3bUL, 0x4620a21cUL, 0x9d642575UL, 0xd4585852UL,
+    0x6c3a598cUL, 0x250624abUL, 0xfe42a3c2UL, 0xb77edee5UL, 0x4d27dbe1UL,
+    0x041ba6c6UL, 0xdf5f21afUL, 0x96635c88UL, 0xaa7754e2UL, 0xe34b29c5UL,
+    0x380faeacUL, 0x7133d38bUL, 0x8b6ad68fUL, 0xc256aba8UL, 0x19122cc1UL,
+    0x502e51e6UL, 0xe84c5038UL, 0xa1702d1fUL, 0x7a34aa76UL, 0x3308d751UL,
+    0xc951d255UL, 0x806daf72UL, 0x5b29281bUL, 0x1215553cUL, 0x230138cfUL,
+    0x6a3d45e8UL, 0xb179c281UL, 0xf845bfa6UL, 0x021cbaa2UL, 0x4b20c785UL,
+    0x906440ecUL, 0xd9583dcbUL, 0x613a3c15UL, 0x28064132UL, 0xf342c65bUL,
+    0xba7ebb7cUL, 0x4027be78UL, 0x091bc35fUL, 0xd25f4436UL, 0x9b633911UL,
+    0xa777317bUL, 0xee4b4c5cUL, 0x350fcb35UL, 0x7c33b612UL, 0x866ab316UL,
+    0xcf56ce31UL, 0x14124958UL, 0x5d2e347fUL, 0xe54c35a1UL, 0xac704886UL,
+    0x7734cfefUL, 0x3e08b2c8UL, 0xc451b7ccUL, 0x8d6dcaebUL, 0x56294d82UL,
+    0x1f1530a5UL
+  },
+  {
+    0x00000000UL, 0x03836bf2UL, 0xf7703be1UL, 0xf4f35013UL, 0x1f979ac7UL,
+    0x1c14f135UL, 0xe8e7a126UL, 0xeb64cad4UL, 0xcf58d98aUL, 0xccdbb278UL,
+    0x3828e26bUL, 0x3bab8999UL, 0xd0cf434dUL, 0xd34c28bfUL, 0x27bf78acUL,
+    0x243c135eUL, 0x6fc75e10UL, 0x6c4435e2UL, 0x98b765f1UL, 0x9b340e03UL,
+    0x7050c4d7UL, 0x73d3af25UL, 0x8720ff36UL, 0x84a394c4UL, 0xa09f879aUL,
+    0xa31cec68UL, 0x57efbc7bUL, 0x546cd789UL, 0xbf081d5dUL, 0xbc8b76afUL,
+    0x487826bcUL, 0x4bfb4d4eUL, 0xde8ebd20UL, 0xdd0dd6d2UL, 0x29fe86c1UL,
+    0x2a7ded33UL, 0xc11927e7UL, 0xc29a4c15UL, 0x36691c06UL, 0x35ea77f4UL,
+    0x11d664aaUL, 0x12550f58UL, 0xe6a65f4bUL, 0xe52534b9UL, 0x0e41fe6dUL,
+    0x0dc2959fUL, 0xf931c58cUL, 0xfab2ae7eUL, 0xb149e330UL, 0xb2ca88c2UL,
+    0x4639d8d1UL, 0x45bab323UL, 0xaede79f7UL, 0xad5d1205UL, 0x59ae4216UL,
+    0x5a2d29e4UL, 0x7e113abaUL, 0x7d925148UL, 0x8961015bUL, 0x8ae26aa9UL,
+    0x6186a07dUL, 0x6205cb8fUL, 0x96f69b9cUL, 0x9575f06eUL, 0xbc1d7b41UL,
+    0xbf9e10b3UL, 0x4b6d40a0UL, 0x48ee2b52UL, 0xa38ae186UL, 0xa0098a74UL,
+    0x54fada67UL, 0x5779b195UL, 0x7345a2cbUL, 0x70c6c939UL, 0x8435992aUL,
+    0x87b6f2d8UL, 0x6cd2380cUL, 0x6f5153feUL, 0x9ba203edUL, 0x9821681fUL,
+    0xd3da2551UL, 0xd0594ea3UL, 0x24aa1eb0UL, 0x27297542UL, 0xcc4dbf96UL,
+    0xcfced464UL, 0x3b3d8477UL, 0x38beef85UL, 0x1c82fcdbUL, 0x1f019729UL,
+    0xebf2c73aUL, 0xe871acc8UL, 0x0315661cUL, 0x00960deeUL, 0xf4655dfdUL,
+    0xf7e6360fUL, 0x6293c661UL, 0x6110ad93UL, 0x95e3fd80UL, 0x96609672UL,
+    0x7d045ca6UL, 0x7e873754UL, 0x8a746747UL, 0x89f70cb5UL, 0xadcb1febUL,
+    0xae487419UL, 0x5abb240aUL, 0x59384ff8UL, 0xb25c852cUL, 0xb1dfeedeUL,
+    0x452cbecdUL, 0x46afd53fUL, 0x0d549871UL, 0x0ed7f383UL, 0xfa24a390UL,
+    0xf9a7c862UL, 0x12c302b6UL, 0x11406944UL, 0xe5b33957UL, 0xe63052a5UL,
+    0xc20c41fbUL, 0xc18f2a09UL, 0x357c7a1aUL, 0x36ff11e8UL, 0xdd9bdb3cUL,
+    0xde18b0ceUL, 0x2aebe0ddUL, 0x29688b2fUL, 0x783bf682UL, 0x7bb89d70UL,
+    0x8f4bcd63UL, 0x8cc8a691UL, 0x67ac6c45UL, 0x642f07b7UL, 0x90dc57a4UL,
+    0x935f3c56UL, 0xb7632f08UL, 0xb4e044faUL, 0x401314e9UL, 0x43907f1bUL,
+    0xa8f4b5cfUL, 0xab77de3dUL, 0x5f848e2eUL, 0x5c07e5dcUL, 0x17fca892UL,
+    0x147fc360UL, 0xe08c9373UL, 0xe30ff881UL, 0x086b3255UL, 0x0be859a7UL,
+    0xff1b09b4UL, 0xfc986246UL, 0xd8a47118UL, 0xdb271aeaUL, 0x2fd44af9UL,
+    0x2c57210bUL, 0xc733ebdfUL, 0xc4b0802dUL, 0x3043d03eUL, 0x33c0bbccUL,
+    0xa6b54ba2UL, 0xa5362050UL, 0x51c57043UL, 0x52461bb1UL, 0xb922d165UL,
+    0xbaa1ba97UL, 0x4e52ea84UL, 0x4dd18176UL, 0x69ed9228UL, 0x6a6ef9daUL,
+    0x9e9da9c9UL, 0x9d1ec23bUL, 0x767a08efUL, 0x75f9631dUL, 0x810a330eUL,
+    0x828958fcUL, 0xc97215b2UL, 0xcaf17e40UL, 0x3e022e53UL, 0x3d8145a1UL,
+    0xd6e58f75UL, 0xd566e487UL, 0x2195b494UL, 0x2216df66UL, 0x062acc38UL,
+    0x05a9a7caUL, 0xf15af7d9UL, 0xf2d99c2bUL, 0x19bd56ffUL, 0x1a3e3d0dUL,
+    0xeecd6d1eUL, 0xed4e06ecUL, 0xc4268dc3UL, 0xc7a5e631UL, 0x3356b622UL,
+    0x30d5ddd0UL, 0xdbb11704UL, 0xd8327cf6UL, 0x2cc12ce5UL, 0x2f424717UL,
+    0x0b7e5449UL, 0x08fd3fbbUL, 0xfc0e6fa8UL, 0xff8d045aUL, 0x14e9ce8eUL,
+    0x176aa57cUL, 0xe399f56fUL, 0xe01a9e9dUL, 0xabe1d3d3UL, 0xa862b821UL,
+    0x5c91e832UL, 0x5f1283c0UL, 0xb4764914UL, 0xb7f522e6UL, 0x430672f5UL,
+    0x40851907UL, 0x64b90a59UL, 0x673a61abUL, 0x93c931b8UL, 0x904a5a4aUL,
+    0x7b2e909eUL, 0x78adfb6cUL, 0x8c5eab7fUL, 0x8fddc08dUL, 0x1aa830e3UL,
+    0x192b5b11UL, 0xedd80b02UL, 0xee5b60f0UL, 0x053faa24UL, 0x06bcc1d6UL,
+    0xf24f91c5UL, 0xf1ccfa37UL, 0xd5f0e969UL, 0xd673829bUL, 0x2280d288UL,
+    0x2103b97aUL, 0xca6773aeUL, 0xc9e4185cUL, 0x3d17484fUL, 0x3e9423bdUL,
+    0x756f6ef3UL, 0x76ec0501UL, 0x821f5512UL, 0x819c3ee0UL, 0x6af8f434UL,
+    0x697b9fc6UL, 0x9d88cfd5UL, 0x9e0ba427UL, 0xba37b779UL, 0xb9b4dc8bUL,
+    0x4d478c98UL, 0x4ec4e76aUL, 0xa5a02dbeUL, 0xa623464cUL, 0x52d0165fUL,
+    0x51537dadUL
+  },
+  {
+    0x00000000UL, 0x7798a213UL, 0xee304527UL, 0x99a8e734UL, 0xdc618a4eUL,
+    0xabf9285dUL, 0x3251cf69UL, 0x45c96d7aUL, 0xb8c3149dUL, 0xcf5bb68eUL,
+    0x56f351baUL, 0x216bf3a9UL, 0x64a29ed3UL, 0x133a3cc0UL, 0x8a92dbf4UL,
+    0xfd0a79e7UL, 0x81f1c53fUL, 0xf669672cUL, 0x6fc18018UL, 0x1859220bUL,
+    0x5d904f71UL, 0x2a08ed62UL, 0xb3a00a56UL, 0xc438a845UL, 0x3932d1a2UL,
+    0x4eaa73b1UL, 0xd7029485UL, 0xa09a3696UL, 0xe5535becUL, 0x92cbf9ffUL,
+    0x0b631ecbUL, 0x7cfbbcd8UL, 0x02e38b7fUL, 0x757b296cUL, 0xecd3ce58UL,
+    0x9b4b6c4bUL, 0xde820131UL, 0xa91aa322UL, 0x30b24416UL, 0x472ae605UL,
+    0xba209fe2UL, 0xcdb83df1UL, 0x5410dac5UL, 0x238878d6UL, 0x664115acUL,
+    0x11d9b7bfUL, 0x8871508bUL, 0xffe9f298UL, 0x83124e40UL, 0xf48aec53UL,
+    0x6d220b67UL, 0x1abaa974UL, 0x5f73c40eUL, 0x28eb661dUL, 0xb1438129UL,
+    0xc6db233aUL, 0x3bd15addUL, 0x4c49f8ceUL, 0xd5e11ffaUL, 0xa279bde9UL,
+    0xe7b0d093UL, 0x90287280UL, 0x098095b4UL, 0x7e1837a7UL, 0x04c617ffUL,
+    0x735eb5ecUL, 0xeaf652d8UL, 0x9d6ef0cbUL, 0xd8a79db1UL, 0xaf3f3fa2UL,
+    0x3697d896UL, 0x410f7a85UL, 0xbc050362UL, 0xcb9da171UL, 0x52354645UL,
+    0x25ade456UL, 0x6064892cUL, 0x17fc2b3fUL, 0x8e54cc0bUL, 0xf9cc6e18UL,
+    0x8537d2c0UL, 0xf2af70d3UL, 0x6b0797e7UL, 0x1c9f35f4UL, 0x5956588eUL,
+    0x2ecefa9dUL, 0xb7661da9UL, 0xc0febfbaUL, 0x3df4c65dUL, 0x4a6c644eUL,
+    0xd3c4837aUL, 0xa45c2169UL, 0xe1954c13UL, 0x960dee00UL, 0x0fa50934UL,
+    0x783dab27UL, 0x06259c80UL, 0x71bd3e93UL, 0xe815d9a7UL, 0x9f8d7bb4UL,
+    0xda4416ceUL, 0xaddcb4ddUL, 0x347453e9UL, 0x43ecf1faUL, 0xbee6881dUL,
+    0xc97e2a0eUL, 0x50d6cd3aUL, 0x274e6f29UL, 0x62870253UL, 0x151fa040UL,
+    0x8cb74774UL, 0xfb2fe567UL, 0x87d459bfUL, 0xf04cfbacUL, 0x69e41c98UL,
+    0x1e7cbe8bUL, 0x5bb5d3f1UL, 0x2c2d71e2UL, 0xb58596d6UL, 0xc21d34c5UL,
+    0x3f174d22UL, 0x488fef31UL, 0xd1270805UL, 0xa6bfaa16UL, 0xe376c76cUL,
+    0x94ee657fUL, 0x0d46824bUL, 0x7ade2058UL, 0xf9fac3fbUL, 0x8e6261e8UL,
+    0x17ca86dcUL, 0x605224cfUL, 0x259b49b5UL, 0x5203eba6UL, 0xcbab0c92UL,
+    0xbc33ae81UL, 0x4139d766UL, 0x36a17575UL, 0xaf099241UL, 0xd8913052UL,
+    0x9d585d28UL, 0xeac0ff3bUL, 0x7368180fUL, 0x04f0ba1cUL, 0x780b06c4UL,
+    0x0f93a4d7UL, 0x963b43e3UL, 0xe1a3e1f0UL, 0xa46a8c8aUL, 0xd3f22e99UL,
+    0x4a5ac9adUL, 0x3dc26bbeUL, 0xc0c81259UL, 0xb750b04aUL, 0x2ef8577eUL,
+    0x5960f56dUL, 0x1ca99817UL, 0x6b313a04UL, 0xf299dd30UL, 0x85017f23UL,
+    0xfb194884UL, 0x8c81ea97UL, 0x15290da3UL, 0x62b1afb0UL, 0x2778c2caUL,
+    0x50e060d9UL, 0xc94887edUL, 0xbed025feUL, 0x43da5c19UL, 0x3442fe0aUL,
+    0xadea193eUL, 0xda72bb2dUL, 0x9fbbd657UL, 0xe8237444UL, 0x718b9370UL,
+    0x06133163UL, 0x7ae88dbbUL, 0x0d702fa8UL, 0x94d8c89cUL, 0xe3406a8fUL,
+    0xa68907f5UL, 0xd111a5e6UL, 0x48b942d2UL, 0x3f21e0c1UL, 0xc22b9926UL,
+    0xb5b33b35UL, 0x2c1bdc01UL, 0x5b837e12UL, 0x1e4a1368UL, 0x69d2b17bUL,
+    0xf07a564fUL, 0x87e2f45cUL, 0xfd3cd404UL, 0x8aa47617UL, 0x130c9123UL,
+    0x64943330UL, 0x215d5e4aUL, 0x56c5fc59UL, 0xcf6d1b6dUL, 0xb8f5b97eUL,
+    0x45ffc099UL, 0x3267628aUL, 0xabcf85beUL, 0xdc5727adUL, 0x999e4ad7UL,
+    0xee06e8c4UL, 0x77ae0ff0UL, 0x0036ade3UL, 0x7ccd113bUL, 0x0b55b328UL,
+    0x92fd541cUL, 0xe565f60fUL, 0xa0ac9b75UL, 0xd7343966UL, 0x4e9cde52UL,
+    0x39047c41UL, 0xc40e05a6UL, 0xb396a7b5UL, 0x2a3e4081UL, 0x5da6e292UL,
+    0x186f8fe8UL, 0x6ff72dfbUL, 0xf65fcacfUL, 0x81c768dcUL, 0xffdf5f7bUL,
+    0x8847fd68UL, 0x11ef1a5cUL, 0x6677b84fUL, 0x23bed535UL, 0x54267726UL,
+    0xcd8e9012UL, 0xba163201UL, 0x471c4be6UL, 0x3084e9f5UL, 0xa92c0ec1UL,
+    0xdeb4acd2UL, 0x9b7dc1a8UL, 0xece563bbUL, 0x754d848fUL, 0x02d5269cUL,
+    0x7e2e9a44UL, 0x09b63857UL, 0x901edf63UL, 0xe7867d70UL, 0xa24f100aUL,
+    0xd5d7b219UL, 0x4c7f552dUL, 0x3be7f73eUL, 0xc6ed8ed9UL, 0xb1752ccaUL,
+    0x28ddcbfeUL, 0x5f4569edUL, 0x1a8c0497UL, 0x6d14a684UL, 0xf4bc41b0UL,
+    0x8324e3a3UL
+  },
+  {
+    0x00000000UL, 0x7e9241a5UL, 0x0d526f4fUL, 0x73c02eeaUL, 0x1aa4de9eUL,
+    0x64369f3bUL, 0x17f6b1d1UL, 0x6964f074UL, 0xc53e5138UL, 0xbbac109dUL,
+    0xc86c3e77UL, 0xb6fe7fd2UL, 0xdf9a8fa6UL, 0xa108ce03UL, 0xd2c8e0e9UL,
+    0xac5aa14cUL, 0x8a7da270UL, 0xf4efe3d5UL, 0x872fcd3fUL, 0xf9bd8c9aUL,
+    0x90d97ceeUL, 0xee4b3d4bUL, 0x9d8b13a1UL, 0xe3195204UL, 0x4f43f348UL,
+    0x31d1b2edUL, 0x42119c07UL, 0x3c83dda2UL, 0x55e72dd6UL, 0x2b756c73UL,
+    0x58b54299UL, 0x2627033cUL, 0x14fb44e1UL, 0x6a690544UL, 0x19a92baeUL,
+    0x673b6a0bUL, 0x0e5f9a7fUL, 0x70cddbdaUL, 0x030df530UL, 0x7d9fb495UL,
+    0xd1c515d9UL, 0xaf57547cUL, 0xdc977a96UL, 0xa2053b33UL, 0xcb61cb47UL,
+    0xb5f38ae2UL, 0xc633a408UL, 0xb8a1e5adUL, 0x9e86e691UL, 0xe014a734UL,
+    0x93d489deUL, 0xed46c87bUL, 0x8422380fUL, 0xfab079aaUL, 0x89705740UL,
+    0xf7e216e5UL, 0x5bb8b7a9UL, 0x252af60cUL, 0x56ead8e6UL, 0x28789943UL,
+    0x411c6937UL, 0x3f8e2892UL, 0x4c4e0678UL, 0x32dc47ddUL, 0xd98065c7UL,
+    0xa7122462UL, 0xd4d20a88UL, 0xaa404b2dUL, 0xc324bb59UL, 0xbdb6fafcUL,
+    0xce76d416UL, 0xb0e495b3UL, 0x1cbe34ffUL, 0x622c755aUL, 0x11ec5bb0UL,
+    0x6f7e1a15UL, 0x061aea61UL, 0x7888abc4UL, 0x0b48852eUL, 0x75dac48bUL,
+    0x53fdc7b7UL, 0x2d6f8612UL, 0x5eafa8f8UL, 0x203de95dUL, 0x49591929UL,
+    0x37cb588cUL, 0x440b7666UL, 0x3a9937c3UL, 0x96c3968fUL, 0xe851d72aUL,
+    0x9b91f9c0UL, 0xe503b865UL, 0x8c674811UL, 0xf2f509b4UL, 0x8135275eUL,
+    0xffa766fbUL, 0xcd7b2126UL, 0xb3e96083UL, 0xc0294e69UL, 0xbebb0fccUL,
+    0xd7dfffb8UL, 0xa94dbe1dUL, 0xda8d90f7UL, 0xa41fd152UL, 0x0845701eUL,
+    0x76d731bbUL, 0x05171f51UL, 0x7b855ef4UL, 0x12e1ae80UL, 0x6c73ef25UL,
+    0x1fb3c1cfUL, 0x6121806aUL, 0x47068356UL, 0x3994c2f3UL, 0x4a54ec19UL,
+    0x34c6adbcUL, 0x5da25dc8UL, 0x23301c6dUL, 0x50f03287UL, 0x2e627322UL,
+    0x8238d26eUL, 0xfcaa93cbUL, 0x8f6abd21UL, 0xf1f8fc84UL, 0x989c0cf0UL,
+    0xe60e4d55UL, 0x95ce63bfUL, 0xeb5c221aUL, 0x4377278bUL, 0x3de5662eUL,
+    0x4e2548c4UL, 0x30b70961UL, 0x59d3f915UL, 0x2741b8b0UL, 0x5481965aUL,
+    0x2a13d7ffUL, 0x864976b3UL, 0xf8db3716UL, 0x8b1b19fcUL, 0xf5895859UL,
+    0x9ceda82dUL, 0xe27fe988UL, 0x91bfc762UL, 0xef2d86c7UL, 0xc90a85fbUL,
+    0xb798c45eUL, 0xc458eab4UL, 0xbacaab11UL, 0xd3ae5b65UL, 0xad3c1ac0UL,
+    0xdefc342aUL, 0xa06e758fUL, 0x0c34d4c3UL, 0x72a69566UL, 0x0166bb8cUL,
+    0x7ff4fa29UL, 0x16900a5dUL, 0x68024bf8UL, 0x1bc26512UL, 0x655024b7UL,
+    0x578c636aUL, 0x291e22cfUL, 0x5ade0c25UL, 0x244c4d80UL, 0x4d28bdf4UL,
+    0x33bafc51UL, 0x407ad2bbUL, 0x3ee8931eUL, 0x92b23252UL, 0xec2073f7UL,
+    0x9fe05d1dUL, 0xe1721cb8UL, 0x8816ecccUL, 0xf684ad69UL, 0x85448383UL,
+    0xfbd6c226UL, 0xddf1c11aUL, 0xa36380bfUL, 0xd0a3ae55UL, 0xae31eff0UL,
+    0xc7551f84UL, 0xb9c75e21UL, 0xca0770cbUL, 0xb495316eUL, 0x18cf9022UL,
+    0x665dd187UL, 0x159dff6dUL, 0x6b0fbec8UL, 0x026b4ebcUL, 0x7cf90f19UL,
+    0x0f3921f3UL, 0x71ab6056UL, 0x9af7424cUL, 0xe46503e9UL, 0x97a52d03UL,
+    0xe9376ca6UL, 0x80539cd2UL, 0xfec1dd77UL, 0x8d01f39dUL, 0xf393b238UL,
+    0x5fc91374UL, 0x215b52d1UL, 0x529b7c3bUL, 0x2c093d9eUL, 0x456dcdeaUL,
+    0x3bff8c4fUL, 0x483fa2a5UL, 0x36ade300UL, 0x108ae03cUL, 0x6e18a199UL,
+    0x1dd88f73UL, 0x634aced6UL, 0x0a2e3ea2UL, 0x74bc7f07UL, 0x077c51edUL,
+    0x79ee1048UL, 0xd5b4b104UL, 0xab26f0a1UL, 0xd8e6de4bUL, 0xa6749feeUL,
+    0xcf106f9aUL, 0xb1822e3fUL, 0xc24200d5UL, 0xbcd04170UL, 0x8e0c06adUL,
+    0xf09e4708UL, 0x835e69e2UL, 0xfdcc2847UL, 0x94a8d833UL, 0xea3a9996UL,
+    0x99fab77cUL, 0xe768f6d9UL, 0x4b325795UL, 0x35a01630UL, 0x466038daUL,
+    0x38f2797fUL, 0x5196890bUL, 0x2f04c8aeUL, 0x5cc4e644UL, 0x2256a7e1UL,
+    0x0471a4ddUL, 0x7ae3e578UL, 0x0923cb92UL, 0x77b18a37UL, 0x1ed57a43UL,
+    0x60473be6UL, 0x1387150cUL, 0x6d1554a9UL, 0xc14ff5e5UL, 0xbfddb440UL,
+    0xcc1d9aaaUL, 0xb28fdb0fUL, 0xdbeb2b7bUL, 0xa5796adeUL, 0xd6b94434UL,
+    0xa82b0591UL
+  },
+  {
+    0x00000000UL, 0xb8aa45ddUL, 0x812367bfUL, 0x39892262UL, 0xf331227bUL,
+    0x4b9b67a6UL, 0x721245c4UL, 0xcab80019UL, 0xe66344f6UL, 0x5ec9012bUL,
+    0x67402349UL, 0xdfea6694UL, 0x1552668dUL, 0xadf82350UL, 0x94710132UL,
+    0x2cdb44efUL, 0x3db164e9UL, 0x851b2134UL, 0xbc920356UL, 0x0438468bUL,
+    0xce804692UL, 0x762a034fUL, 0x4fa3212dUL, 0xf70964f0UL, 0xdbd2201fUL,
+    0x637865c2UL, 0x5af147a0UL, 0xe25b027dUL, 0x28e30264UL, 0x904947b9UL,
+    0xa9c065dbUL, 0x116a2006UL, 0x8b1425d7UL, 0x33be600aUL, 0x0a374268UL,
+    0xb29d07b5UL, 0x782507acUL, 0xc08f4271UL, 0xf9066013UL, 0x41ac25ceUL,
+    0x6d776121UL, 0xd5dd24fcUL, 0xec54069eUL, 0x54fe4343UL, 0x9e46435aUL,
+    0x26ec0687UL, 0x1f6524e5UL, 0xa7cf6138UL, 0xb6a5413eUL, 0x0e0f04e3UL,
+    0x37862681UL, 0x8f2c635cUL, 0x45946345UL, 0xfd3e2698UL, 0xc4b704faUL,
+    0x7c1d4127UL, 0x50c605c8UL, 0xe86c4015UL, 0xd1e56277UL, 0x694f27aaUL,
+    0xa3f727b3UL, 0x1b5d626eUL, 0x22d4400cUL, 0x9a7e05d1UL, 0xe75fa6abUL,
+    0x5ff5e376UL, 0x667cc114UL, 0xded684c9UL, 0x146e84d0UL, 0xacc4c10dUL,
+    0x954de36fUL, 0x2de7a6b2UL, 0x013ce25dUL, 0xb996a780UL, 0x801f85e2UL,
+    0x38b5c03fUL, 0xf20dc026UL, 0x4aa785fbUL, 0x732ea799UL, 0xcb84e244UL,
+    0xdaeec242UL, 0x6244879fUL, 0x5bcda5fdUL, 0xe367e020UL, 0x29dfe039UL,
+    0x9175a5e4UL, 0xa8fc8786UL, 0x1056c25bUL, 0x3c8d86b4UL, 0x8427c369UL,
+    0xbdaee10bUL, 0x0504a4d6UL, 0xcfbca4cfUL, 0x7716e112UL, 0x4e9fc370UL,
+    0xf63586adUL, 0x6c4b837cUL, 0xd4e1c6a1UL, 0xed68e4c3UL, 0x55c2a11eUL,
+    0x9f7aa107UL, 0x27d0e4daUL, 0x1e59c6b8UL, 0xa6f38365UL, 0x8a28c78aUL,
+    0x32828257UL, 0x0b0ba035UL, 0xb3a1e5e8UL, 0x7919e5f1UL, 0xc1b3a02cUL,
+    0xf83a824eUL, 0x4090c793UL, 0x51fae795UL, 0xe950a248UL, 0xd0d9802aUL,
+    0x6873c5f7UL, 0xa2cbc5eeUL, 0x1a618033UL, 0x23e8a251UL, 0x9b42e78cUL,
+    0xb799a363UL, 0x0f33e6beUL, 0x36bac4dcUL, 0x8e108101UL, 0x44a88118UL,
+    0xfc02c4c5UL, 0xc58be6a7UL, 0x7d21a37aUL, 0x3fc9a052UL, 0x8763e58fUL,
+    0xbeeac7edUL, 0x06408230UL, 0xccf88229UL, 0x7452c7f4UL, 0x4ddbe596UL,
+    0xf571a04bUL, 0xd9aae4a4UL, 0x6100a179UL, 0x5889831bUL, 0xe023c6c6UL,
+    0x2a9bc6dfUL, 0x92318302UL, 0xabb8a160UL, 0x1312e4bdUL, 0x0278c4bbUL,
+    0xbad28166UL, 0x835ba304UL, 0x3bf1e6d9UL, 0xf149e6c0UL, 0x49e3a31dUL,
+    0x706a817fUL, 0xc8c0c4a2UL, 0xe41b804dUL, 0x5cb1c590UL, 0x6538e7f2UL,
+    0xdd92a22fUL, 0x172aa236UL, 0xaf80e7ebUL, 0x9609c589UL, 0x2ea38054UL,
+    0xb4dd8585UL, 0x0c77c058UL, 0x35fee23aUL, 0x8d54a7e7UL, 0x47eca7feUL,
+    0xff46e223UL, 0xc6cfc041UL, 0x7e65859cUL, 0x52bec173UL, 0xea1484aeUL,
+    0xd39da6ccUL, 0x6b37e311UL, 0xa18fe308UL, 0x1925a6d5UL, 0x20ac84b7UL,
+    0x9806c16aUL, 0x896ce16cUL, 0x31c6a4b1UL, 0x084f86d3UL, 0xb0e5c30eUL,
+    0x7a5dc317UL, 0xc2f786caUL, 0xfb7ea4a8UL, 0x43d4e175UL, 0x6f0fa59aUL,
+    0xd7a5e047UL, 0xee2cc225UL, 0x568687f8UL, 0x9c3e87e1UL, 0x2494c23cUL,
+    0x1d1de05eUL, 0xa5b7a583UL, 0xd89606f9UL, 0x603c4324UL, 0x59b56146UL,
+    0xe11f249bUL, 0x2ba72482UL, 0x930d615fUL, 0xaa84433dUL, 0x122e06e0UL,
+    0x3ef5420fUL, 0x865f07d2UL, 0xbfd625b0UL, 0x077c606dUL, 0xcdc46074UL,
+    0x756e25a9UL, 0x4ce707cbUL, 0xf44d4216UL, 0xe5276210UL, 0x5d8d27cdUL,
+    0x640405afUL, 0xdcae4072UL, 0x1616406bUL, 0xaebc05b6UL, 0x973527d4UL,
+    0x2f9f6209UL, 0x034426e6UL, 0xbbee633bUL, 0x82674159UL, 0x3acd0484UL,
+    0xf075049dUL, 0x48df4140UL, 0x71566322UL, 0xc9fc26ffUL, 0x5382232eUL,
+    0xeb2866f3UL, 0xd2a14491UL, 0x6a0b014cUL, 0xa0b30155UL, 0x18194488UL,
+    0x219066eaUL, 0x993a2337UL, 0xb5e167d8UL, 0x0d4b2205UL, 0x34c20067UL,
+    0x8c6845baUL, 0x46d045a3UL, 0xfe7a007eUL, 0xc7f3221cUL, 0x7f5967c1UL,
+    0x6e3347c7UL, 0xd699021aUL, 0xef102078UL, 0x57ba65a5UL, 0x9d0265bcUL,
+    0x25a82061UL, 0x1c210203UL, 0xa48b47deUL, 0x88500331UL, 0x30fa46ecUL,
+    0x0973648eUL, 0xb1d92153UL, 0x7b61214aUL, 0xc3cb6497UL, 0xfa4246f5UL,
+    0x42e80328UL
+  },
+  {
+    0x00000000UL, 0xac6f1138UL, 0x58df2270UL, 0xf4b03348UL, 0xb0be45e0UL,
+    0x1cd154d8UL, 0xe8616790UL, 0x440e76a8UL, 0x910b67c5UL, 0x3d6476fdUL,
+    0xc9d445b5UL, 0x65bb548dUL, 0x21b52225UL, 0x8dda331dUL, 0x796a0055UL,
+    0xd505116dUL, 0xd361228fUL, 0x7f0e33b7UL, 0x8bbe00ffUL, 0x27d111c7UL,
+    0x63df676fUL, 0xcfb07657UL, 0x3b00451fUL, 0x976f5427UL, 0x426a454aUL,
+    0xee055472UL, 0x1ab5673aUL, 0xb6da7602UL, 0xf2d400aaUL, 0x5ebb1192UL,
+    0xaa0b22daUL, 0x066433e2UL, 0x57b5a81bUL, 0xfbdab923UL, 0x0f6a8a6bUL,
+    0xa3059b53UL, 0xe70bedfbUL, 0x4b64fcc3UL, 0xbfd4cf8bUL, 0x13bbdeb3UL,
+    0xc6becfdeUL, 0x6ad1dee6UL, 0x9e61edaeUL, 0x320efc96UL, 0x76008a3eUL,
+    0xda6f9b06UL, 0x2edfa84eUL, 0x82b0b976UL, 0x84d48a94UL, 0x28bb9bacUL,
+    0xdc0ba8e4UL, 0x7064b9dcUL, 0x346acf74UL, 0x9805de4cUL, 0x6cb5ed04UL,
+    0xc0dafc3cUL, 0x15dfed51UL, 0xb9b0fc69UL, 0x4d00cf21UL, 0xe16fde19UL,
+    0xa561a8b1UL, 0x090eb989UL, 0xfdbe8ac1UL, 0x51d19bf9UL, 0xae6a5137UL,
+    0x0205400fUL, 0xf6b57347UL, 0x5ada627fUL, 0x1ed414d7UL, 0xb2bb05efUL,
+    0x460b36a7UL, 0xea64279fUL, 0x3f6136f2UL, 0x930e27caUL, 0x67be1482UL,
+    0xcbd105baUL, 0x8fdf7312UL, 0x23b0622aUL, 0xd7005162UL, 0x7b6f405aUL,
+    0x7d0b73b8UL, 0xd1646280UL, 0x25d451c8UL, 0x89bb40f0UL, 0xcdb53658UL,
+    0x61da2760UL, 0x956a1428UL, 0x39050510UL, 0xec00147dUL, 0x406f0545UL,
+    0xb4df360dUL, 0x18b02735UL, 0x5cbe519dUL, 0xf0d140a5UL, 0x046173edUL,
+    0xa80e62d5UL, 0xf9dff92cUL, 0x55b0e814UL, 0xa100db5cUL, 0x0d6fca64UL,
+    0x4961bcccUL, 0xe50eadf4UL, 0x11be9ebcUL, 0xbdd18f84UL, 0x68d49ee9UL,
+    0xc4bb8fd1UL, 0x300bbc99UL, 0x9c64ada1UL, 0xd86adb09UL, 0x7405ca31UL,
+    0x80b5f979UL, 0x2cdae841UL, 0x2abedba3UL, 0x86d1ca9bUL, 0x7261f9d3UL,
+    0xde0ee8ebUL, 0x9a009e43UL, 0x366f8f7bUL, 0xc2dfbc33UL, 0x6eb0ad0bUL,
+    0xbbb5bc66UL, 0x17daad5eUL, 0xe36a9e16UL, 0x4f058f2eUL, 0x0b0bf986UL,
+    0xa764e8beUL, 0x53d4dbf6UL, 0xffbbcaceUL, 0x5cd5a26eUL, 0xf0bab356UL,
+    0x040a801eUL, 0xa8659126UL, 0xec6be78eUL, 0x4004f6b6UL, 0xb4b4c5feUL,
+    0x18dbd4c6UL, 0xcddec5abUL, 0x61b1d493UL, 0x9501e7dbUL, 0x396ef6e3UL,
+    0x7d60804bUL, 0xd10f9173UL, 0x25bfa23bUL, 0x89d0b303UL, 0x8fb480e1UL,
+    0x23db91d9UL, 0xd76ba291UL, 0x7b04b3a9UL, 0x3f0ac501UL, 0x9365d439UL,
+    0x67d5e771UL, 0xcbbaf649UL, 0x1ebfe724UL, 0xb2d0f61cUL, 0x4660c554UL,
+    0xea0fd46cUL, 0xae01a2c4UL, 0x026eb3fcUL, 0xf6de80b4UL, 0x5ab1918cUL,
+    0x0b600a75UL, 0xa70f1b4dUL, 0x53bf2805UL, 0xffd0393dUL, 0xbbde4f95UL,
+    0x17b15eadUL, 0xe3016de5UL, 0x4f6e7cddUL, 0x9a6b6db0UL, 0x36047c88UL,
+    0xc2b44fc0UL, 0x6edb5ef8UL, 0x2ad52850UL, 0x86ba3968UL, 0x720a0a20UL,
+    0xde651b18UL, 0xd80128faUL, 0x746e39c2UL, 0x80de0a8aUL, 0x2cb11bb2UL,
+    0x68bf6d1aUL, 0xc4d07c22UL, 0x30604f6aUL, 0x9c0f5e52UL, 0x490a4f3fUL,
+    0xe5655e07UL, 0x11d56d4fUL, 0xbdba7c77UL, 0xf9b40adfUL, 0x55db1be7UL,
+    0xa16b28afUL, 0x0d043997UL, 0xf2bff359UL, 0x5ed0e261UL, 0xaa60d129UL,
+    0x060fc011UL, 0x4201b6b9UL, 0xee6ea781UL, 0x1ade94c9UL, 0xb6b185f1UL,
+    0x63b4949cUL, 0xcfdb85a4UL, 0x3b6bb6ecUL, 0x9704a7d4UL, 0xd30ad17cUL,
+    0x7f65c044UL, 0x8bd5f30cUL, 0x27bae234UL, 0x21ded1d6UL, 0x8db1c0eeUL,
+    0x7901f3a6UL, 0xd56ee29eUL, 0x91609436UL, 0x3d0f850eUL, 0xc9bfb646UL,
+    0x65d0a77eUL, 0xb0d5b613UL, 0x1cbaa72bUL, 0xe80a9463UL, 0x4465855bUL,
+    0x006bf3f3UL, 0xac04e2cbUL, 0x58b4d183UL, 0xf4dbc0bbUL, 0xa50a5b42UL,
+    0x09654a7aUL, 0xfdd57932UL, 0x51ba680aUL, 0x15b41ea2UL, 0xb9db0f9aUL,
+    0x4d6b3cd2UL, 0xe1042deaUL, 0x34013c87UL, 0x986e2dbfUL, 0x6cde1ef7UL,
+    0xc0b10fcfUL, 0x84bf7967UL, 0x28d0685fUL, 0xdc605b17UL, 0x700f4a2fUL,
+    0x766b79cdUL, 0xda0468f5UL, 0x2eb45bbdUL, 0x82db4a85UL, 0xc6d53c2dUL,
+    0x6aba2d15UL, 0x9e0a1e5dUL, 0x32650f65UL, 0xe7601e08UL, 0x4b0f0f30UL,
+    0xbfbf3c78UL, 0x13d02d40UL, 0x57de5be8UL, 0xfbb14ad0UL, 0x0f017998UL,
+    0xa36e68a0UL
+  },
+  {
+    0x00000000UL, 0x196b30efUL, 0xc3a08cdbUL, 0xdacbbc34UL, 0x7737f5b2UL,
+    0x6e5cc55dUL, 0xb4977969UL, 0xadfc4986UL, 0x1f180660UL, 0x0673368fUL,
+    0xdcb88abbUL, 0xc5d3ba54UL, 0x682ff3d2UL, 0x7144c33dUL, 0xab8f7f09UL,
+    0xb2e44fe6UL, 0x3e300cc0UL, 0x275b3c2fUL, 0xfd90801bUL, 0xe4fbb0f4UL,
+    0x4907f972UL, 0x506cc99dUL, 0x8aa775a9UL, 0x93cc4546UL, 0x21280aa0UL,
+    0x38433a4fUL, 0xe288867bUL, 0xfbe3b694UL, 0x561fff12UL, 0x4f74cffdUL,
+    0x95bf73c9UL, 0x8cd44326UL, 0x8d16f485UL, 0x947dc46aUL, 0x4eb6785eUL,
+    0x57dd48b1UL, 0xfa210137UL, 0xe34a31d8UL, 0x39818decUL, 0x20eabd03UL,
+    0x920ef2e5UL, 0x8b65c20aUL, 0x51ae7e3eUL, 0x48c54ed1UL, 0xe5390757UL,
+    0xfc5237b8UL, 0x26998b8cUL, 0x3ff2bb63UL, 0xb326f845UL, 0xaa4dc8aaUL,
+    0x7086749eUL, 0x69ed4471UL, 0xc4110df7UL, 0xdd7a3d18UL, 0x07b1812cUL,
+    0x1edab1c3UL, 0xac3efe25UL, 0xb555cecaUL, 0x6f9e72feUL, 0x76f54211UL,
+    0xdb090b97UL, 0xc2623b78UL, 0x18a9874cUL, 0x01c2b7a3UL, 0xeb5b040eUL,
+    0xf23034e1UL, 0x28fb88d5UL, 0x3190b83aUL, 0x9c6cf1bcUL, 0x8507c153UL,
+    0x5fcc7d67UL, 0x46a74d88UL, 0xf443026eUL, 0xed283281UL, 0x37e38eb5UL,
+    0x2e88be5aUL, 0x8374f7dcUL, 0x9a1fc733UL, 0x40d47b07UL, 0x59bf4be8UL,
+    0xd56b08ceUL, 0xcc003821UL, 0x16cb8415UL, 0x0fa0b4faUL, 0xa25cfd7cUL,
+    0xbb37cd93UL, 0x61fc71a7UL, 0x78974148UL, 0xca730eaeUL, 0xd3183e41UL,
+    0x09d38275UL, 0x10b8b29aUL, 0xbd44fb1cUL, 0xa42fcbf3UL, 0x7ee477c7UL,
+    0x678f4728UL, 0x664df08bUL, 0x7f26c064UL, 0xa5ed7c50UL, 0xbc864cbfUL,
+    0x117a0539UL, 0x081135d6UL, 0xd2da89e2UL, 0xcbb1b90dUL, 0x7955f6ebUL,
+    0x603ec604UL, 0xbaf57a30UL, 0xa39e4adfUL, 0x0e620359UL, 0x170933b6UL,
+    0xcdc28f82UL, 0xd4a9bf6dUL, 0x587dfc4bUL, 0x4116cca4UL, 0x9bdd7090UL,
+    0x82b6407fUL, 0x2f4a09f9UL, 0x36213916UL, 0xecea8522UL, 0xf581b5cdUL,
+    0x4765fa2bUL, 0x5e0ecac4UL, 0x84c576f0UL, 0x9dae461fUL, 0x30520f99UL,
+    0x29393f76UL, 0xf3f28342UL, 0xea99b3adUL, 0xd6b7081cUL, 0xcfdc38f3UL,
+    0x151784c7UL, 0x0c7cb428UL, 0xa180fdaeUL, 0xb8ebcd41UL, 0x62207175UL,
+    0x7b4b419aUL, 0xc9af0e7cUL, 0xd0c43e93UL, 0x0a0f82a7UL, 0x1364b248UL,
+    0xbe98fbceUL, 0xa7f3cb21UL, 0x7d387715UL, 0x645347faUL, 0xe88704dcUL,
+    0xf1ec3433UL, 0x2b278807UL, 0x324cb8e8UL, 0x9fb0f16eUL, 0x86dbc181UL,
+    0x5c107db5UL, 0x457b4d5aUL, 0xf79f02bcUL, 0xeef43253UL, 0x343f8e67UL,
+    0x2d54be88UL, 0x80a8f70eUL, 0x99c3c7e1UL, 0x43087bd5UL, 0x5a634b3aUL,
+    0x5ba1fc99UL, 0x42cacc76UL, 0x98017042UL, 0x816a40adUL, 0x2c96092bUL,
+    0x35fd39c4UL, 0xef3685f0UL, 0xf65db51fUL, 0x44b9faf9UL, 0x5dd2ca16UL,
+    0x87197622UL, 0x9e7246cdUL, 0x338e0f4bUL, 0x2ae53fa4UL, 0xf02e8390UL,
+    0xe945b37fUL, 0x6591f059UL, 0x7cfac0b6UL, 0xa6317c82UL, 0xbf5a4c6dUL,
+    0x12a605ebUL, 0x0bcd3504UL, 0xd1068930UL, 0xc86db9dfUL, 0x7a89f639UL,
+    0x63e2c6d6UL, 0xb9297ae2UL, 0xa0424a0dUL, 0x0dbe038bUL, 0x14d53364UL,
+    0xce1e8f50UL, 0xd775bfbfUL, 0x3dec0c12UL, 0x24873cfdUL, 0xfe4c80c9UL,
+    0xe727b026UL, 0x4adbf9a0UL, 0x53b0c94fUL, 0x897b757bUL, 0x90104594UL,
+    0x22f40a72UL, 0x3b9f3a9dUL, 0xe15486a9UL, 0xf83fb646UL, 0x55c3ffc0UL,
+    0x4ca8cf2fUL, 0x9663731bUL, 0x8f0843f4UL, 0x03dc00d2UL, 0x1ab7303dUL,
+    0xc07c8c09UL, 0xd917bce6UL, 0x74ebf560UL, 0x6d80c58fUL, 0xb74b79bbUL,
+    0xae204954UL, 0x1cc406b2UL, 0x05af365dUL, 0xdf648a69UL, 0xc60fba86UL,
+    0x6bf3f300UL, 0x7298c3efUL, 0xa8537fdbUL, 0xb1384f34UL, 0xb0faf897UL,
+    0xa991c878UL, 0x735a744cUL, 0x6a3144a3UL, 0xc7cd0d25UL, 0xdea63dcaUL,
+    0x046d81feUL, 0x1d06b111UL, 0xafe2fef7UL, 0xb689ce18UL, 0x6c42722cUL,
+    0x752942c3UL, 0xd8d50b45UL, 0xc1be3baaUL, 0x1b75879eUL, 0x021eb771UL,
+    0x8ecaf457UL, 0x97a1c4b8UL, 0x4d6a788cUL, 0x54014863UL, 0xf9fd01e5UL,
+    0xe096310aUL, 0x3a5d8d3eUL, 0x2336bdd1UL, 0x91d2f237UL, 0x88b9c2d8UL,
+    0x52727eecUL, 0x4b194e03UL, 0xe6e50785UL, 0xff8e376aUL, 0x25458b5eUL,
+    0x3c2ebbb1UL
+  },
+  {
+    0x00000000UL, 0xc82c0368UL, 0x905906d0UL, 0x587505b8UL, 0xd1c5e0a5UL,
+    0x19e9e3cdUL, 0x419ce675UL, 0x89b0e51dUL, 0x53fd2d4eUL, 0x9bd12e26UL,
+    0xc3a42b9eUL, 0x0b8828f6UL, 0x8238cdebUL, 0x4a14ce83UL, 0x1261cb3bUL,
+    0xda4dc853UL, 0xa6fa5b9cUL, 0x6ed658f4UL, 0x36a35d4cUL, 0xfe8f5e24UL,
+    0x773fbb39UL, 0xbf13b851UL, 0xe766bde9UL, 0x2f4abe81UL, 0xf50776d2UL,
+    0x3d2b75baUL, 0x655e7002UL, 0xad72736aUL, 0x24c29677UL, 0xecee951fUL,
+    0xb49b90a7UL, 0x7cb793cfUL, 0xbd835b3dUL, 0x75af5855UL, 0x2dda5dedUL,
+    0xe5f65e85UL, 0x6c46bb98UL, 0xa46ab8f0UL, 0xfc1fbd48UL, 0x3433be20UL,
+    0xee7e7673UL, 0x2652751bUL, 0x7e2770a3UL, 0xb60b73cbUL, 0x3fbb96d6UL,
+    0xf79795beUL, 0xafe29006UL, 0x67ce936eUL, 0x1b7900a1UL, 0xd35503c9UL,
+    0x8b200671UL, 0x430c0519UL, 0xcabce004UL, 0x0290e36cUL, 0x5ae5e6d4UL,
+    0x92c9e5bcUL, 0x48842defUL, 0x80a82e87UL, 0xd8dd2b3fUL, 0x10f12857UL,
+    0x9941cd4aUL, 0x516dce22UL, 0x0918cb9aUL, 0xc134c8f2UL, 0x7a07b77aUL,
+    0xb22bb412UL, 0xea5eb1aaUL, 0x2272b2c2UL, 0xabc257dfUL, 0x63ee54b7UL,
+    0x3b9b510fUL, 0xf3b75267UL, 0x29fa9a34UL, 0xe1d6995cUL, 0xb9a39ce4UL,
+    0x718f9f8cUL, 0xf83f7a91UL, 0x301379f9UL, 0x68667c41UL, 0xa04a7f29UL,
+    0xdcfdece6UL, 0x14d1ef8eUL, 0x4ca4ea36UL, 0x8488e95eUL, 0x0d380c43UL,
+    0xc5140f2bUL, 0x9d610a93UL, 0x554d09fbUL, 0x8f00c1a8UL, 0x472cc2c0UL,
+    0x1f59c778UL, 0xd775c410UL, 0x5ec5210dUL, 0x96e92265UL, 0xce9c27ddUL,
+    0x06b024b5UL, 0xc784ec47UL, 0x0fa8ef2fUL, 0x57ddea97UL, 0x9ff1e9ffUL,
+    0x16410ce2UL, 0xde6d0f8aUL, 0x86180a32UL, 0x4e34095aUL, 0x9479c109UL,
+    0x5c55c261UL, 0x0420c7d9UL, 0xcc0cc4b1UL, 0x45bc21acUL, 0x8d9022c4UL,
+    0xd5e5277cUL, 0x1dc92414UL, 0x617eb7dbUL, 0xa952b4b3UL, 0xf127b10bUL,
+    0x390bb263UL, 0xb0bb577eUL, 0x78975416UL, 0x20e251aeUL, 0xe8ce52c6UL,
+    0x32839a95UL, 0xfaaf99fdUL, 0xa2da9c45UL, 0x6af69f2dUL, 0xe3467a30UL,
+    0x2b6a7958UL, 0x731f7ce0UL, 0xbb337f88UL, 0xf40e6ef5UL, 0x3c226d9dUL,
+    0x64576825UL, 0xac7b6b4dUL, 0x25cb8e50UL, 0xede78d38UL, 0xb5928880UL,
+    0x7dbe8be8UL, 0xa7f343bbUL, 0x6fdf40d3UL, 0x37aa456bUL, 0xff864603UL,
+    0x7636a31eUL, 0xbe1aa076UL, 0xe66fa5ceUL, 0x2e43a6a6UL, 0x52f43569UL,
+    0x9ad83601UL, 0xc2ad33b9UL, 0x0a8130d1UL, 0x8331d5ccUL, 0x4b1dd6a4UL,
+    0x1368d31cUL, 0xdb44d074UL, 0x01091827UL, 0xc9251b4fUL, 0x91501ef7UL,
+    0x597c1d9fUL, 0xd0ccf882UL, 0x18e0fbeaUL, 0x4095fe52UL, 0x88b9fd3aUL,
+    0x498d35c8UL, 0x81a136a0UL, 0xd9d43318UL, 0x11f83070UL, 0x9848d56dUL,
+    0x5064d605UL, 0x0811d3bdUL, 0xc03dd0d5UL, 0x1a701886UL, 0xd25c1beeUL,
+    0x8a291e56UL, 0x42051d3eUL, 0xcbb5f823UL, 0x0399fb4bUL, 0x5becfef3UL,
+    0x93c0fd9bUL, 0xef776e54UL, 0x275b6d3cUL, 0x7f2e6884UL, 0xb7026becUL,
+    0x3eb28ef1UL, 0xf69e8d99UL, 0xaeeb8821UL, 0x66c78b49UL, 0xbc8a431aUL,
+    0x74a64072UL, 0x2cd345caUL, 0xe4ff46a2UL, 0x6d4fa3bfUL, 0xa563a0d7UL,
+    0xfd16a56fUL, 0x353aa607UL, 0x8e09d98fUL, 0x4625dae7UL, 0x1e50df5fUL,
+    0xd67cdc37UL, 0x5fcc392aUL, 0x97e03a42UL, 0xcf953ffaUL, 0x07b93c92UL,
+    0xddf4f4c1UL, 0x15d8f7a9UL, 0x4dadf211UL, 0x8581f179UL, 0x0c311464UL,
+    0xc41d170cUL, 0x9c6812b4UL, 0x544411dcUL, 0x28f38213UL, 0xe0df817bUL,
+    0xb8aa84c3UL, 0x708687abUL, 0xf93662b6UL, 0x311a61deUL, 0x696f6466UL,
+    0xa143670eUL, 0x7b0eaf5dUL, 0xb322ac35UL, 0xeb57a98dUL, 0x237baae5UL,
+    0xaacb4ff8UL, 0x62e74c90UL, 0x3a924928UL, 0xf2be4a40UL, 0x338a82b2UL,
+    0xfba681daUL, 0xa3d38462UL, 0x6bff870aUL, 0xe24f6217UL, 0x2a63617fUL,
+    0x721664c7UL, 0xba3a67afUL, 0x6077affcUL, 0xa85bac94UL, 0xf02ea92cUL,
+    0x3802aa44UL, 0xb1b24f59UL, 0x799e4c31UL, 0x21eb4989UL, 0xe9c74ae1UL,
+    0x9570d92eUL, 0x5d5cda46UL, 0x0529dffeUL, 0xcd05dc96UL, 0x44b5398bUL,
+    0x8c993ae3UL, 0xd4ec3f5bUL, 0x1cc03c33UL, 0xc68df460UL, 0x0ea1f708UL,
+    0x56d4f2b0UL, 0x9ef8f1d8UL, 0x174814c5UL, 0xdf6417adUL, 0x87111215UL,
+    0x4f3d117dUL
+  },
+  {
+    0x00000000UL, 0x277d3c49UL, 0x4efa7892UL, 0x698744dbUL, 0x6d821d21UL,
+    0x4aff2168UL, 0x237865b3UL, 0x040559faUL, 0xda043b42UL, 0xfd79070bUL,
+    0x94fe43d0UL, 0xb3837f99UL, 0xb7862663UL, 0x90fb1a2aUL, 0xf97c5ef1UL,
+    0xde0162b8UL, 0xb4097684UL, 0x93744acdUL, 0xfaf30e16UL, 0xdd8e325fUL,
+    0xd98b6ba5UL, 0xfef657ecUL, 0x97711337UL, 0xb00c2f7eUL, 0x6e0d4dc6UL,
+    0x4970718fUL, 0x20f73554UL, 0x078a091dUL, 0x038f50e7UL, 0x24f26caeUL,
+    0x4d752875UL, 0x6a08143cUL, 0x9965000dUL, 0xbe183c44UL, 0xd79f789fUL,
+    0xf0e244d6UL, 0xf4e71d2cUL, 0xd39a2165UL, 0xba1d65beUL, 0x9d6059f7UL,
+    0x43613b4fUL, 0x641c0706UL, 0x0d9b43ddUL, 0x2ae67f94UL, 0x2ee3266eUL,
+    0x099e1a27UL, 0x60195efcUL, 0x476462b5UL, 0x2d6c7689UL, 0x0a114ac0UL,
+    0x63960e1bUL, 0x44eb3252UL, 0x40ee6ba8UL, 0x679357e1UL, 0x0e14133aUL,
+    0x29692f73UL, 0xf7684dcbUL, 0xd0157182UL, 0xb9923559UL, 0x9eef0910UL,
+    0x9aea50eaUL, 0xbd976ca3UL, 0xd4102878UL, 0xf36d1431UL, 0x32cb001aUL,
+    0x15b63c53UL, 0x7c317888UL, 0x5b4c44c1UL, 0x5f491d3bUL, 0x78342172UL,
+    0x11b365a9UL, 0x36ce59e0UL, 0xe8cf3b58UL, 0xcfb20711UL, 0xa63543caUL,
+    0x81487f83UL, 0x854d2679UL, 0xa2301a30UL, 0xcbb75eebUL, 0xecca62a2UL,
+    0x86c2769eUL, 0xa1bf4ad7UL, 0xc8380e0cUL, 0xef453245UL, 0xeb406bbfUL,
+    0xcc3d57f6UL, 0xa5ba132dUL, 0x82c72f64UL, 0x5cc64ddcUL, 0x7bbb7195UL,
+    0x123c354eUL, 0x35410907UL, 0x314450fdUL, 0x16396cb4UL, 0x7fbe286fUL,
+    0x58c31426UL, 0xabae0017UL, 0x8cd33c5eUL, 0xe5547885UL, 0xc22944ccUL,
+    0xc62c1d36UL, 0xe151217fUL, 0x88d665a4UL, 0xafab59edUL, 0x71aa3b55UL,
+    0x56d7071cUL, 0x3f5043c7UL, 0x182d7f8eUL, 0x1c282674UL, 0x3b551a3dUL,
+    0x52d25ee6UL, 0x75af62afUL, 0x1fa77693UL, 0x38da4adaUL, 0x515d0e01UL,
+    0x76203248UL, 0x72256bb2UL, 0x555857fbUL, 0x3cdf1320UL, 0x1ba22f69UL,
+    0xc5a34dd1UL, 0xe2de7198UL, 0x8b593543UL, 0xac24090aUL, 0xa82150f0UL,
+    0x8f5c6cb9UL, 0xe6db2862UL, 0xc1a6142bUL, 0x64960134UL, 0x43eb3d7dUL,
+    0x2a6c79a6UL, 0x0d1145efUL, 0x09141c15UL, 0x2e69205cUL, 0x47ee6487UL,
+    0x609358ceUL, 0xbe923a76UL, 0x99ef063fUL, 0xf06842e4UL, 0xd7157eadUL,
+    0xd3102757UL, 0xf46d1b1eUL, 0x9dea5fc5UL, 0xba97638cUL, 0xd09f77b0UL,
+    0xf7e24bf9UL, 0x9e650f22UL, 0xb918336bUL, 0xbd1d6a91UL, 0x9a6056d8UL,
+    0xf3e71203UL, 0xd49a2e4aUL, 0x0a9b4cf2UL, 0x2de670bbUL, 0x44613460UL,
+    0x631c0829UL, 0x671951d3UL, 0x40646d9aUL, 0x29e32941UL, 0x0e9e1508UL,
+    0xfdf30139UL, 0xda8e3d70UL, 0xb30979abUL, 0x947445e2UL, 0x90711c18UL,
+    0xb70c2051UL, 0xde8b648aUL, 0xf9f658c3UL, 0x27f73a7bUL, 0x008a0632UL,
+    0x690d42e9UL, 0x4e707ea0UL, 0x4a75275aUL, 0x6d081b13UL, 0x048f5fc8UL,
+    0x23f26381UL, 0x49fa77bdUL, 0x6e874bf4UL, 0x07000f2fUL, 0x207d3366UL,
+    0x24786a9cUL, 0x030556d5UL, 0x6a82120eUL, 0x4dff2e47UL, 0x93fe4cffUL,
+    0xb48370b6UL, 0xdd04346dUL, 0xfa790824UL, 0xfe7c51deUL, 0xd9016d97UL,
+    0xb086294cUL, 0x97fb1505UL, 0x565d012eUL, 0x71203d67UL, 0x18a779bcUL,
+    0x3fda45f5UL, 0x3bdf1c0fUL, 0x1ca22046UL, 0x7525649dUL, 0x525858d4UL,
+    0x8c593a6cUL, 0xab240625UL, 0xc2a342feUL, 0xe5de7eb7UL, 0xe1db274dUL,
+    0xc6a61b04UL, 0xaf215fdfUL, 0x885c6396UL, 0xe25477aaUL, 0xc5294be3UL,
+    0xacae0f38UL, 0x8bd33371UL, 0x8fd66a8bUL, 0xa8ab56c2UL, 0xc12c1219UL,
+    0xe6512e50UL, 0x38504ce8UL, 0x1f2d70a1UL, 0x76aa347aUL, 0x51d70833UL,
+    0x55d251c9UL, 0x72af6d80UL, 0x1b28295bUL, 0x3c551512UL, 0xcf380123UL,
+    0xe8453d6aUL, 0x81c279b1UL, 0xa6bf45f8UL, 0xa2ba1c02UL, 0x85c7204bUL,
+    0xec406490UL, 0xcb3d58d9UL, 0x153c3a61UL, 0x32410628UL, 0x5bc642f3UL,
+    0x7cbb7ebaUL, 0x78be2740UL, 0x5fc31b09UL, 0x36445fd2UL, 0x1139639bUL,
+    0x7b3177a7UL, 0x5c4c4beeUL, 0x35cb0f35UL, 0x12b6337cUL, 0x16b36a86UL,
+    0x31ce56cfUL, 0x58491214UL, 0x7f342e5dUL, 0xa1354ce5UL, 0x864870acUL,
+    0xefcf3477UL, 0xc8b2083eUL, 0xccb751c4UL, 0xebca6d8dUL, 0x824d2956UL,
+    0xa530151fUL
+#endif
+  }
+};
+
+local const z_crc_t FAR crc32c_x2n_table[32] = {
+    0x40000000UL, 0x20000000UL, 0x08000000UL, 0x00800000UL, 0x00008000UL,
+    0x82f63b78UL, 0x6ea2d55cUL, 0x18b8ea18UL, 0x510ac59aUL, 0xb82be955UL,
+    0xb8fdb1e7UL, 0x88e56f72UL, 0x74c360a4UL, 0xe4172b16UL, 0x0d65762aUL,
+    0x35d73a62UL, 0x28461564UL, 0xbf455269UL, 0xe2ea32dcUL, 0xfe7740e6UL,
+    0xf946610bUL, 0x3c204f8fUL, 0x538586e3UL, 0x59726915UL, 0x734d5309UL,
+    0xbc1ac763UL, 0x7d0722ccUL, 0xd289cabeUL, 0xe94ca9bcUL, 0x05b74f3fUL,
+    0xa51e1f42UL, 0x40000000UL
+};
+
+#ifdef Z_X86_SIMD
+local const z_crc_t FAR crc32c_shift_table[4][256] =
+{
+  {
+    0x00000000UL, 0xbd6f81f8UL, 0x7f337501UL, 0xc25cf4f9UL, 0xfe66ea02UL,
+    0x43096bfaUL, 0x81559f03UL, 0x3c3a1efbUL, 0xf921a2f5UL, 0x444e230dUL,
+    0x8612d7f4UL, 0x3b7d560cUL, 0x074748f7UL, 0xba28c90fUL, 0x78743df6UL,
+    0xc51bbc0eUL, 0xf7af331bUL, 0x4ac0b2e3UL, 0x889c461aUL, 0x35f3c7e2UL,
+    0x09c9d919UL, 0xb4a658e1UL, 0x76faac18UL, 0xcb952de0UL, 0x0e8e91eeUL,
+    0xb3e11016UL, 0x71bde4efUL, 0xccd26517UL, 0xf0e87becUL, 0x4d87fa14UL,
+    0x8fdb0eedUL, 0x32b48f15UL, 0xeab210c7UL, 0x57dd913fUL, 0x958165c6UL,
+    0x28eee43eUL, 0x14d4fac5UL, 0xa9bb7b3dUL, 0x6be78fc4UL, 0xd6880e3cUL,
+    0x1393b232UL, 0xaefc33caUL, 0x6ca0c733UL, 0xd1cf46cbUL, 0xedf55830UL,
+    0x509ad9c8UL, 0x92c62d31UL, 0x2fa9acc9UL, 0x1d1d23dcUL, 0xa072a224UL,
+    0x622e56ddUL, 0xdf41d725UL, 0xe37bc9deUL, 0x5e144826UL, 0x9c48bcdfUL,
+    0x21273d27UL, 0xe43c8129UL, 0x595300d1UL, 0x9b0ff428UL, 0x266075d0UL,
+    0x1a5a6b2bUL, 0xa735ead3UL, 0x65691e2aUL, 0xd8069fd2UL, 0xd088577fUL,
+    0x6de7d687UL, 0xafbb227eUL, 0x12d4a386UL, 0x2eeebd7dUL, 0x93813c85UL,
+    0x51ddc87cUL, 0xecb24984UL, 0x29a9f58aUL, 0x94c67472UL, 0x569a808bUL,
+    0xebf50173UL, 0xd7cf1f88UL, 0x6aa09e70UL, 0xa8fc6a89UL, 0x1593eb71UL,
+    0x27276464UL, 0x9a48e59cUL, 0x58141165UL, 0xe57b909dUL, 0xd9418e66UL,
+    0x642e0f9eUL, 0xa672fb67UL, 0x1b1d7a9fUL, 0xde06c691UL, 0x63694769UL,
+    0xa135b390UL, 0x1c5a3268UL, 0x20602c93UL, 0x9d0fad6bUL, 0x5f535992UL,
+    0xe23cd86aUL, 0x3a3a47b8UL, 0x8755c640UL, 0x450932b9UL, 0xf866b341UL,
+    0xc45cadbaUL, 0x79332c42UL, 0xbb6fd8bbUL, 0x06005943UL, 0xc31be54dUL,
+    0x7e7464b5UL, 0xbc28904cUL, 0x014711b4UL, 0x3d7d0f4fUL, 0x80128eb7UL,
+    0x424e7a4eUL, 0xff21fbb6UL, 0xcd9574a3UL, 0x70faf55bUL, 0xb2a601a2UL,
+    0x0fc9805aUL, 0x33f39ea1UL, 0x8e9c1f59UL, 0x4cc0eba0UL, 0xf1af6a58UL,
+    0x34b4d656UL, 0x89db57aeUL, 0x4b87a357UL, 0xf6e822afUL, 0xcad23c54UL,
+    0x77bdbdacUL, 0xb5e14955UL, 0x088ec8adUL, 0xa4fcd80fUL, 0x199359f7UL,
+    0xdbcfad0eUL, 0x66a02cf6UL, 0x5a9a320dUL, 0xe7f5b3f5UL, 0x25a9470cUL,
+    0x98c6c6f4UL, 0x5ddd7afaUL, 0xe0b2fb02UL, 0x22ee0ffbUL, 0x9f818e03UL,
+    0xa3bb90f8UL, 0x1ed41100UL, 0xdc88e5f9UL, 0x61e76401UL, 0x5353eb14UL,
+    0xee3c6aecUL, 0x2c609e15UL, 0x910f1fedUL, 0xad350116UL, 0x105a80eeUL,
+    0xd2067417UL, 0x6f69f5efUL, 0xaa7249e1UL, 0x171dc819UL, 0xd5413ce0UL,
+    0x682ebd18UL, 0x5414a3e3UL, 0xe97b221bUL, 0x2b27d6e2UL, 0x9648571aUL,
+    0x4e4ec8c8UL, 0xf3214930UL, 0x317dbdc9UL, 0x8c123c31UL, 0xb02822caUL,
+    0x0d47a332UL, 0xcf1b57cbUL, 0x7274d633UL, 0xb76f6a3dUL, 0x0a00ebc5UL,
+    0xc85c1f3cUL, 0x75339ec4UL, 0x4909803fUL, 0xf46601c7UL, 0x363af53eUL,
+    0x8b5574c6UL, 0xb9e1fbd3UL, 0x048e7a2bUL, 0xc6d28ed2UL, 0x7bbd0f2aUL,
+    0x478711d1UL, 0xfae89029UL, 0x38b464d0UL, 0x85dbe528UL, 0x40c05926UL,
+    0xfdafd8deUL, 0x3ff32c27UL, 0x829caddfUL, 0xbea6b324UL, 0x03c932dcUL,
+    0xc195c625UL, 0x7cfa47ddUL, 0x74748f70UL, 0xc91b0e88UL, 0x0b47fa71UL,
+    0xb6287b89UL, 0x8a126572UL, 0x377de48aUL, 0xf5211073UL, 0x484e918bUL,
+    0x8d552d85UL, 0x303aac7dUL, 0xf2665884UL, 0x4f09d97cUL, 0x7333c787UL,
+    0xce5c467fUL, 0x0c00b286UL, 0xb16f337eUL, 0x83dbbc6bUL, 0x3eb43d93UL,
+    0xfce8c96aUL, 0x41874892UL, 0x7dbd5669UL, 0xc0d2d791UL, 0x028e2368UL,
+    0xbfe1a290UL, 0x7afa1e9eUL, 0xc7959f66UL, 0x05c96b9fUL, 0xb8a6ea67UL,
+    0x849cf49cUL, 0x39f37564UL, 0xfbaf819dUL, 0x46c00065UL, 0x9ec69fb7UL,
+    0x23a91e4fUL, 0xe1f5eab6UL, 0x5c9a6b4eUL, 0x60a075b5UL, 0xddcff44dUL,
+    0x1f9300b4UL, 0xa2fc814cUL, 0x67e73d42UL, 0xda88bcbaUL, 0x18d44843UL,
+    0xa5bbc9bbUL, 0x9981d740UL, 0x24ee56b8UL, 0xe6b2a241UL, 0x5bdd23b9UL,
+    0x6969acacUL, 0xd4062d54UL, 0x165ad9adUL, 0xab355855UL, 0x970f46aeUL,
+    0x2a60c756UL, 0xe83c33afUL, 0x5553b257UL, 0x90480e59UL, 0x2d278fa1UL,
+    0xef7b7b58UL, 0x5214faa0UL, 0x6e2ee45bUL, 0xd34165a3UL, 0x111d915aUL,
+    0xac7210a2UL
+  },
+  {
+    0x00000000UL, 0x4c15c6efUL, 0x982b8ddeUL, 0xd43e4b31UL, 0x35bb6d4dUL,
+    0x79aeaba2UL, 0xad90e093UL, 0xe185267cUL, 0x6b76da9aUL, 0x27631c75UL,
+    0xf35d5744UL, 0xbf4891abUL, 0x5ecdb7d7UL, 0x12d87138UL, 0xc6e63a09UL,
+    0x8af3fce6UL, 0xd6edb534UL, 0x9af873dbUL, 0x4ec638eaUL, 0x02d3fe05UL,
+    0xe356d879UL, 0xaf431e96UL, 0x7b7d55a7UL, 0x37689348UL, 0xbd9b6faeUL,
+    0xf18ea941UL, 0x25b0e270UL, 0x69a5249fUL, 0x882002e3UL, 0xc435c40cUL,
+    0x100b8f3dUL, 0x5c1e49d2UL, 0xa8371c99UL, 0xe422da76UL, 0x301c9147UL,
+    0x7c0957a8UL, 0x9d8c71d4UL, 0xd199b73bUL, 0x05a7fc0aUL, 0x49b23ae5UL,
+    0xc341c603UL, 0x8f5400ecUL, 0x5b6a4bddUL, 0x177f8d32UL, 0xf6faab4eUL,
+    0xbaef6da1UL, 0x6ed12690UL, 0x22c4e07fUL, 0x7edaa9adUL, 0x32cf6f42UL,
+    0xe6f12473UL, 0xaae4e29cUL, 0x4b61c4e0UL, 0x0774020fUL, 0xd34a493eUL,
+    0x9f5f8fd1UL, 0x15ac7337UL, 0x59b9b5d8UL, 0x8d87fee9UL, 0xc1923806UL,
+    0x20171e7aUL, 0x6c02d895UL, 0xb83c93a4UL, 0xf429554bUL, 0x55824fc3UL,
+    0x1997892cUL, 0xcda9c21dUL, 0x81bc04f2UL, 0x6039228eUL, 0x2c2ce461UL,
+    0xf812af50UL, 0xb40769bfUL, 0x3ef49559UL, 0x72e153b6UL, 0xa6df1887UL,
+    0xeacade68UL, 0x0b4ff814UL, 0x475a3efbUL, 0x936475caUL, 0xdf71b325UL,
+    0x836ffaf7UL, 0xcf7a3c18UL, 0x1b447729UL, 0x5751b1c6UL, 0xb6d497baUL,
+    0xfac15155UL, 0x2eff1a64UL, 0x62eadc8bUL, 0xe819206dUL, 0xa40ce682UL,
+    0x7032adb3UL, 0x3c276b5cUL, 0xdda24d20UL, 0x91b78bcfUL, 0x4589c0feUL,
+    0x099c0611UL, 0xfdb5535aUL, 0xb1a095b5UL, 0x659ede84UL, 0x298b186bUL,
+    0xc80e3e17UL, 0x841bf8f8UL, 0x5025b3c9UL, 0x1c307526UL, 0x96c389c0UL,
+    0xdad64f2fUL, 0x0ee8041eUL, 0x42fdc2f1UL, 0xa378e48dUL, 0xef6d2262UL,
+    0x3b536953UL, 0x7746afbcUL, 0x2b58e66eUL, 0x674d2081UL, 0xb3736bb0UL,
+    0xff66ad5fUL, 0x1ee38b23UL, 0x52f64dccUL, 0x86c806fdUL, 0xcaddc012UL,
+    0x402e3cf4UL, 0x0c3bfa1bUL, 0xd805b12aUL, 0x941077c5UL, 0x759551b9UL,
+    0x39809756UL, 0xedbedc67UL, 0xa1ab1a88UL, 0xab049f86UL, 0xe7115969UL,
+    0x332f1258UL, 0x7f3ad4b7UL, 0x9ebff2cbUL, 0xd2aa3424UL, 0x06947f15UL,
+    0x4a81b9faUL, 0xc072451cUL, 0x8c6783f3UL, 0x5859c8c2UL, 0x144c0e2dUL,
+    0xf5c92851UL, 0xb9dceebeUL, 0x6de2a58fUL, 0x21f76360UL, 0x7de92ab2UL,
+    0x31fcec5dUL, 0xe5c2a76cUL, 0xa9d76183UL, 0x485247ffUL, 0x04478110UL,
+    0xd079ca21UL, 0x9c6c0cceUL, 0x169ff028UL, 0x5a8a36c7UL, 0x8eb47df6UL,
+    0xc2a1bb19UL, 0x23249d65UL, 0x6f315b8aUL, 0xbb0f10bbUL, 0xf71ad654UL,
+    0x0333831fUL, 0x4f2645f0UL, 0x9b180ec1UL, 0xd70dc82eUL, 0x3688ee52UL,
+    0x7a9d28bdUL, 0xaea3638cUL, 0xe2b6a563UL, 0x68455985UL, 0x24509f6aUL,
+    0xf06ed45bUL, 0xbc7b12b4UL, 0x5dfe34c8UL, 0x11ebf227UL, 0xc5d5b916UL,
+    0x89c07ff9UL, 0xd5de362bUL, 0x99cbf0c4UL, 0x4df5bbf5UL, 0x01e07d1aUL,
+    0xe0655b66UL, 0xac709d89UL, 0x784ed6b8UL, 0x345b1057UL, 0xbea8ecb1UL,
+    0xf2bd2a5eUL, 0x2683616fUL, 0x6a96a780UL, 0x8b1381fcUL, 0xc7064713UL,
+    0x13380c22UL, 0x5f2dcacdUL, 0xfe86d045UL, 0xb29316aaUL, 0x66ad5d9bUL,
+    0x2ab89b74UL, 0xcb3dbd08UL, 0x87287be7UL, 0x531630d6UL, 0x1f03f639UL,
+    0x95f00adfUL, 0xd9e5cc30UL, 0x0ddb8701UL, 0x41ce41eeUL, 0xa04b6792UL,
+    0xec5ea17dUL, 0x3860ea4cUL, 0x74752ca3UL, 0x286b6571UL, 0x647ea39eUL,
+    0xb040e8afUL, 0xfc552e40UL, 0x1dd0083cUL, 0x51c5ced3UL, 0x85fb85e2UL,
+    0xc9ee430dUL, 0x431dbfebUL, 0x0f087904UL, 0xdb363235UL, 0x9723f4daUL,
+    0x76a6d2a6UL, 0x3ab31449UL, 0xee8d5f78UL, 0xa2989997UL, 0x56b1ccdcUL,
+    0x1aa40a33UL, 0xce9a4102UL, 0x828f87edUL, 0x630aa191UL, 0x2f1f677eUL,
+    0xfb212c4fUL, 0xb734eaa0UL, 0x3dc71646UL, 0x71d2d0a9UL, 0xa5ec9b98UL,
+    0xe9f95d77UL, 0x087c7b0bUL, 0x4469bde4UL, 0x9057f6d5UL, 0xdc42303aUL,
+    0x805c79e8UL, 0xcc49bf07UL, 0x1877f436UL, 0x546232d9UL, 0xb5e714a5UL,
+    0xf9f2d24aUL, 0x2dcc997bUL, 0x61d95f94UL, 0xeb2aa372UL, 0xa73f659dUL,
+    0x73012eacUL, 0x3f14e843UL, 0xde91ce3fUL, 0x928408d0UL, 0x46ba43e1UL,
+    0x0aaf850eUL
+  },
+  {
+    0x00000000UL, 0x53e549fdUL, 0xa7ca93faUL, 0xf42fda07UL, 0x4a795105UL,
+    0x199c18f8UL, 0xedb3c2ffUL, 0xbe568b02UL, 0x94f2a20aUL, 0xc717ebf7UL,
+    0x333831f0UL, 0x60dd780dUL, 0xde8bf30fUL, 0x8d6ebaf2UL, 0x794160f5UL,
+    0x2aa42908UL, 0x2c0932e5UL, 0x7fec7b18UL, 0x8bc3a11fUL, 0xd826e8e2UL,
+    0x667063e0UL, 0x35952a1dUL, 0xc1baf01aUL, 0x925fb9e7UL, 0xb8fb90efUL,
+    0xeb1ed912UL, 0x1f310315UL, 0x4cd44ae8UL, 0xf282c1eaUL, 0xa1678817UL,
+    0x55485210UL, 0x06ad1bedUL, 0x581265caUL, 0x0bf72c37UL, 0xffd8f630UL,
+    0xac3dbfcdUL, 0x126b34cfUL, 0x418e7d32UL, 0xb5a1a735UL, 0xe644eec8UL,
+    0xcce0c7c0UL, 0x9f058e3dUL, 0x6b2a543aUL, 0x38cf1dc7UL, 0x869996c5UL,
+    0xd57cdf38UL, 0x2153053fUL, 0x72b64cc2UL, 0x741b572fUL, 0x27fe1ed2UL,
+    0xd3d1c4d5UL, 0x80348d28UL, 0x3e62062aUL, 0x6d874fd7UL, 0x99a895d0UL,
+    0xca4ddc2dUL, 0xe0e9f525UL, 0xb30cbcd8UL, 0x472366dfUL, 0x14c62f22UL,
+    0xaa90a420UL, 0xf975edddUL, 0x0d5a37daUL, 0x5ebf7e27UL, 0xb024cb94UL,
+    0xe3c18269UL, 0x17ee586eUL, 0x440b1193UL, 0xfa5d9a91UL, 0xa9b8d36cUL,
+    0x5d97096bUL, 0x0e724096UL, 0x24d6699eUL, 0x77332063UL, 0x831cfa64UL,
+    0xd0f9b399UL, 0x6eaf389bUL, 0x3d4a7166UL, 0xc965ab61UL, 0x9a80e29cUL,
+    0x9c2df971UL, 0xcfc8b08cUL, 0x3be76a8bUL, 0x68022376UL, 0xd654a874UL,
+    0x85b1e189UL, 0x719e3b8eUL, 0x227b7273UL, 0x08df5b7bUL, 0x5b3a1286UL,
+    0xaf15c881UL, 0xfcf0817cUL, 0x42a60a7eUL, 0x11434383UL, 0xe56c9984UL,
+    0xb689d079UL, 0xe836ae5eUL, 0xbbd3e7a3UL, 0x4ffc3da4UL, 0x1c197459UL,
+    0xa24fff5bUL, 0xf1aab6a6UL, 0x05856ca1UL, 0x5660255cUL, 0x7cc40c54UL,
+    0x2f2145a9UL, 0xdb0e9faeUL, 0x88ebd653UL, 0x36bd5d51UL, 0x655814acUL,
+    0x9177ceabUL, 0xc2928756UL, 0xc43f9cbbUL, 0x97dad546UL, 0x63f50f41UL,
+    0x301046bcUL, 0x8e46cdbeUL, 0xdda38443UL, 0x298c5e44UL, 0x7a6917b9UL,
+    0x50cd3eb1UL, 0x0328774cUL, 0xf707ad4bUL, 0xa4e2e4b6UL, 0x1ab46fb4UL,
+    0x49512649UL, 0xbd7efc4eUL, 0xee9bb5b3UL, 0x65a5e1d9UL, 0x3640a824UL,
+    0xc26f7223UL, 0x918a3bdeUL, 0x2fdcb0dcUL, 0x7c39f921UL, 0x88162326UL,
+    0xdbf36adbUL, 0xf15743d3UL, 0xa2b20a2eUL, 0x569dd029UL, 0x057899d4UL,
+    0xbb2e12d6UL, 0xe8cb5b2bUL, 0x1ce4812cUL, 0x4f01c8d1UL, 0x49acd33cUL,
+    0x1a499ac1UL, 0xee6640c6UL, 0xbd83093bUL, 0x03d58239UL, 0x5030cbc4UL,
+    0xa41f11c3UL, 0xf7fa583eUL, 0xdd5e7136UL, 0x8ebb38cbUL, 0x7a94e2ccUL,
+    0x2971ab31UL, 0x97272033UL, 0xc4c269ceUL, 0x30edb3c9UL, 0x6308fa34UL,
+    0x3db78413UL, 0x6e52cdeeUL, 0x9a7d17e9UL, 0xc9985e14UL, 0x77ced516UL,
+    0x242b9cebUL, 0xd00446ecUL, 0x83e10f11UL, 0xa9452619UL, 0xfaa06fe4UL,
+    0x0e8fb5e3UL, 0x5d6afc1eUL, 0xe33c771cUL, 0xb0d93ee1UL, 0x44f6e4e6UL,
+    0x1713ad1bUL, 0x11beb6f6UL, 0x425bff0bUL, 0xb674250cUL, 0xe5916cf1UL,
+    0x5bc7e7f3UL, 0x0822ae0eUL, 0xfc0d7409UL, 0xafe83df4UL, 0x854c14fcUL,
+    0xd6a95d01UL, 0x22868706UL, 0x7163cefbUL, 0xcf3545f9UL, 0x9cd00c04UL,
+    0x68ffd603UL, 0x3b1a9ffeUL, 0xd5812a4dUL, 0x866463b0UL, 0x724bb9b7UL,
+    0x21aef04aUL, 0x9ff87b48UL, 0xcc1d32b5UL, 0x3832e8b2UL, 0x6bd7a14fUL,
+    0x41738847UL, 0x1296c1baUL, 0xe6b91bbdUL, 0xb55c5240UL, 0x0b0ad942UL,
+    0x58ef90bfUL, 0xacc04ab8UL, 0xff250345UL, 0xf98818a8UL, 0xaa6d5155UL,
+    0x5e428b52UL, 0x0da7c2afUL, 0xb3f149adUL, 0xe0140050UL, 0x143bda57UL,
+    0x47de93aaUL, 0x6d7abaa2UL, 0x3e9ff35fUL, 0xcab02958UL, 0x995560a5UL,
+    0x2703eba7UL, 0x74e6a25aUL, 0x80c9785dUL, 0xd32c31a0UL, 0x8d934f87UL,
+    0xde76067aUL, 0x2a59dc7dUL, 0x79bc9580UL, 0xc7ea1e82UL, 0x940f577fUL,
+    0x60208d78UL, 0x33c5c485UL, 0x1961ed8dUL, 0x4a84a470UL, 0xbeab7e77UL,
+    0xed4e378aUL, 0x5318bc88UL, 0x00fdf575UL, 0xf4d22f72UL, 0xa737668fUL,
+    0xa19a7d62UL, 0xf27f349fUL, 0x0650ee98UL, 0x55b5a765UL, 0xebe32c67UL,
+    0xb806659aUL, 0x4c29bf9dUL, 0x1fccf660UL, 0x3568df68UL, 0x668d9695UL,
+    0x92a24c92UL, 0xc147056fUL, 0x7f118e6dUL, 0x2cf4c790UL, 0xd8db1d97UL,
+    0x8b3e546aUL
+  },
+  {
+    0x00000000UL, 0xcb4bc3b2UL, 0x937bf195UL, 0x58303227UL, 0x231b95dbUL,
+    0xe8505669UL, 0xb060644eUL, 0x7b2ba7fcUL, 0x46372bb6UL, 0x8d7ce804UL,
+    0xd54cda23UL, 0x1e071991UL, 0x652cbe6dUL, 0xae677ddfUL, 0xf6574ff8UL,
+    0x3d1c8c4aUL, 0x8c6e576cUL, 0x472594deUL, 0x1f15a6f9UL, 0xd45e654bUL,
+    0xaf75c2b7UL, 0x643e0105UL, 0x3c0e3322UL, 0xf745f090UL, 0xca597cdaUL,
+    0x0112bf68UL, 0x59228d4fUL, 0x92694efdUL, 0xe942e901UL, 0x22092ab3UL,
+    0x7a391894UL, 0xb172db26UL, 0x1d30d829UL, 0xd67b1b9bUL, 0x8e4b29bcUL,
+    0x4500ea0eUL, 0x3e2b4df2UL, 0xf5608e40UL, 0xad50bc67UL, 0x661b7fd5UL,
+    0x5b07f39fUL, 0x904c302dUL, 0xc87c020aUL, 0x0337c1b8UL, 0x781c6644UL,
+    0xb357a5f6UL, 0xeb6797d1UL, 0x202c5463UL, 0x915e8f45UL, 0x5a154cf7UL,
+    0x02257ed0UL, 0xc96ebd62UL, 0xb2451a9eUL, 0x790ed92cUL, 0x213eeb0bUL,
+    0xea7528b9UL, 0xd769a4f3UL, 0x1c226741UL, 0x44125566UL, 0x8f5996d4UL,
+    0xf4723128UL, 0x3f39f29aUL, 0x6709c0bdUL, 0xac42030fUL, 0x3a61b052UL,
+    0xf12a73e0UL, 0xa91a41c7UL, 0x62518275UL, 0x197a2589UL, 0xd231e63bUL,
+    0x8a01d41cUL, 0x414a17aeUL, 0x7c569be4UL, 0xb71d5856UL, 0xef2d6a71UL,
+    0x2466a9c3UL, 0x5f4d0e3fUL, 0x9406cd8dUL, 0xcc36ffaaUL, 0x077d3c18UL,
+    0xb60fe73eUL, 0x7d44248cUL, 0x257416abUL, 0xee3fd519UL, 0x951472e5UL,
+    0x5e5fb157UL, 0x066f8370UL, 0xcd2440c2UL, 0xf038cc88UL, 0x3b730f3aUL,
+    0x63433d1dUL, 0xa808feafUL, 0xd3235953UL, 0x18689ae1UL, 0x4058a8c6UL,
+    0x8b136b74UL, 0x2751687bUL, 0xec1aabc9UL, 0xb42a99eeUL, 0x7f615a5cUL,
+    0x044afda0UL, 0xcf013e12UL, 0x97310c35UL, 0x5c7acf87UL, 0x616643cdUL,
+    0xaa2d807fUL, 0xf21db258UL, 0x395671eaUL, 0x427dd616UL, 0x893615a4UL,
+    0xd1062783UL, 0x1a4de431UL, 0xab3f3f17UL, 0x6074fca5UL, 0x3844ce82UL,
+    0xf30f0d30UL, 0x8824aaccUL, 0x436f697eUL, 0x1b5f5b59UL, 0xd01498ebUL,
+    0xed0814a1UL, 0x2643d713UL, 0x7e73e534UL, 0xb5382686UL, 0xce13817aUL,
+    0x055842c8UL, 0x5d6870efUL, 0x9623b35dUL, 0x74c360a4UL, 0xbf88a316UL,
+    0xe7b89131UL, 0x2cf35283UL, 0x57d8f57fUL, 0x9c9336cdUL, 0xc4a304eaUL,
+    0x0fe8c758UL, 0x32f44b12UL, 0xf9bf88a0UL, 0xa18fba87UL, 0x6ac47935UL,
+    0x11efdec9UL, 0xdaa41d7bUL, 0x82942f5cUL, 0x49dfeceeUL, 0xf8ad37c8UL,
+    0x33e6f47aUL, 0x6bd6c65dUL, 0xa09d05efUL, 0xdbb6a213UL, 0x10fd61a1UL,
+    0x48cd5386UL, 0x83869034UL, 0xbe9a1c7eUL, 0x75d1dfccUL, 0x2de1edebUL,
+    0xe6aa2e59UL, 0x9d8189a5UL, 0x56ca4a17UL, 0x0efa7830UL, 0xc5b1bb82UL,
+    0x69f3b88dUL, 0xa2b87b3fUL, 0xfa884918UL, 0x31c38aaaUL, 0x4ae82d56UL,
+    0x81a3eee4UL, 0xd993dcc3UL, 0x12d81f71UL, 0x2fc4933bUL, 0xe48f5089UL,
+    0xbcbf62aeUL, 0x77f4a11cUL, 0x0cdf06e0UL, 0xc794c552UL, 0x9fa4f775UL,
+    0x54ef34c7UL, 0xe59defe1UL, 0x2ed62c53UL, 0x76e61e74UL, 0xbdadddc6UL,
+    0xc6867a3aUL, 0x0dcdb988UL, 0x55fd8bafUL, 0x9eb6481dUL, 0xa3aac457UL,
+    0x68e107e5UL, 0x30d135c2UL, 0xfb9af670UL, 0x80b1518cUL, 0x4bfa923eUL,
+    0x13caa019UL, 0xd88163abUL, 0x4ea2d0f6UL, 0x85e91344UL, 0xddd92163UL,
+    0x1692e2d1UL, 0x6db9452dUL, 0xa6f2869fUL, 0xfec2b4b8UL, 0x3589770aUL,
+    0x0895fb40UL, 0xc3de38f2UL, 0x9bee0ad5UL, 0x50a5c967UL, 0x2b8e6e9bUL,
+    0xe0c5ad29UL, 0xb8f59f0eUL, 0x73be5cbcUL, 0xc2cc879aUL, 0x09874428UL,
+    0x51b7760fUL, 0x9afcb5bdUL, 0xe1d71241UL, 0x2a9cd1f3UL, 0x72ace3d4UL,
+    0xb9e72066UL, 0x84fbac2cUL, 0x4fb06f9eUL, 0x17805db9UL, 0xdccb9e0bUL,
+    0xa7e039f7UL, 0x6cabfa45UL, 0x349bc862UL, 0xffd00bd0UL, 0x539208dfUL,
+    0x98d9cb6dUL, 0xc0e9f94aUL, 0x0ba23af8UL, 0x70899d04UL, 0xbbc25eb6UL,
+    0xe3f26c91UL, 0x28b9af23UL, 0x15a52369UL, 0xdeeee0dbUL, 0x86ded2fcUL,
+    0x4d95114eUL, 0x36beb6b2UL, 0xfdf57500UL, 0xa5c54727UL, 0x6e8e8495UL,
+    0xdffc5fb3UL, 0x14b79c01UL, 0x4c87ae26UL, 0x87cc6d94UL, 0xfce7ca68UL,
+    0x37ac09daUL, 0x6f9c3bfdUL, 0xa4d7f84fUL, 0x99cb7405UL, 0x5280b7b7UL,
+    0x0ab08590UL, 0xc1fb4622UL, 0xbad0e1deUL, 0x719b226cUL, 0x29ab104bUL,
+    0xe2e0d3f9UL
+  }
+};
+#endif
@@ -51,6 +51,21 @@
 
 #include "deflate.h"
 
+#ifdef Z_X86_SIMD
+#  include <emmintrin.h>
+#  include <immintrin.h>
+#endif
+
+/* Compare strings eight bytes at a time in longest_match() on 64-bit
+   processors that load unaligned words quickly, where the first difference
+   is found by counting zero bits.  Define UNALIGNED_OK to use the two-byte
+   comparison instead. */
+#if !defined(FASTEST) && !defined(ASMV) && !defined(UNALIGNED_OK) && \
+    defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#  define MATCH_WORD
+#endif
+
 const char deflate_copyright[] =
    " deflate 1.2.8 Copyright 1995-2013 Jean-loup Gailly and Mark Adler ";
 /*
@@ -74,22 +89,45 @@ typedef block_state (*compress_func) OF((deflate_state *s, int flush));
 /* Compression function. Returns the block state after the call. */
 
 local void fill_window    OF((deflate_state *s));
+local void insert_run     OF((deflate_state *s, uInt str, uInt count));
+local void fix_hash       OF((deflate_state *s));
+local void keep_window    OF((deflate_state *s, const Bytef *buf,
+                              unsigned used));
 local block_state deflate_stored OF((deflate_state *s, int flush));
+local int incompressible  OF((const Bytef *buf, unsigned len));
+local block_state raw_end        OF((deflate_state *s));
+local block_state deflate_raw    OF((deflate_state *s, int flush));
 local block_state deflate_fast   OF((deflate_state *s, int flush));
 #ifndef FASTEST
 local block_state deflate_slow   OF((deflate_state *s, int flush));
+local block_state deflate_medium OF((deflate_state *s, int flush));
+local uInt medium_match   OF((deflate_state *s, IPos hash_head));
+local block_state deflate_optimal OF((deflate_state *s, int flush));
+local uInt opt_find       OF((deflate_state *s, unsigned i, IPos cur_match,
+                              unsigned max_len));
+local void opt_matches    OF((deflate_state *s, unsigned n));
+local void opt_greedy     OF((deflate_state *s, unsigned n));
+local void opt_parse      OF((deflate_state *s, unsigned n));
+local unsigned opt_count  OF((deflate_state *s, unsigned n));
+local ulg opt_price       OF((deflate_state *s, int block, int chunk,
+                              int costs));
+local unsigned opt_refine OF((deflate_state *s, unsigned n, int block,
+                              uInt passes));
 #endif
 local block_state deflate_rle    OF((deflate_state *s, int flush));
 local block_state deflate_huff   OF((deflate_state *s, int flush));
+local block_state deflate_quick  OF((deflate_state *s, int flush));
+#ifdef FASTEST
+#  define quick_match longest_match
+#else
+local uInt quick_match    OF((deflate_state *s, IPos cur_match));
+#endif
 local void lm_init        OF((deflate_state *s));
 local void putShortMSB    OF((deflate_state *s, uInt b));
 local void flush_pending  OF((z_streamp strm));
 local int read_buf        OF((z_streamp strm, Bytef *buf, unsigned size));
 #ifdef ASMV
       void match_init OF((void)); /* asm code initialization */
-      uInt longest_match  OF((deflate_state *s, IPos cur_match));
-#else
-local uInt longest_match  OF((deflate_state *s, IPos cur_match));
 #endif
 
 #ifdef DEBUG
@@ -110,7 +148,7 @@ local  void check_match OF((deflate_state *s, IPos start, IPos match,
 /* Matches of length 3 are discarded if their distance exceeds TOO_FAR */
 
 /* Values for max_lazy_match, good_match and max_chain_length, depending on
- * the desired pack level (0..9). The values given below have been tuned to
+ * the desired pack level (0..12). The values given below have been tuned to
  * exclude worst case performance for pathological files. Better values may be
  * found for specific files.
  */
@@ -128,26 +166,52 @@ local const config configuration_table[2] = {
 /* 0 */ {0,    0,  0,    0, deflate_stored},  /* store only */
 /* 1 */ {4,    4,  8,    4, deflate_fast}}; /* max speed, no lazy matches */
 #else
-local const config configuration_table[10] = {
+local const config configuration_table[13] = {
 /*      good lazy nice chain */
 /* 0 */ {0,    0,  0,    0, deflate_stored},  /* store only */
 /* 1 */ {4,    4,  8,    4, deflate_fast}, /* max speed, no lazy matches */
 /* 2 */ {4,    5, 16,    8, deflate_fast},
 /* 3 */ {4,    6, 32,   32, deflate_fast},
 
-/* 4 */ {4,    4, 16,   16, deflate_slow},  /* lazy matches */
-/* 5 */ {8,   16, 32,   32, deflate_slow},
-/* 6 */ {8,   16, 128, 128, deflate_slow},
-/* 7 */ {8,   32, 128, 256, deflate_slow},
+/* 4 */ {4,    4, 16,   16, deflate_medium}, /* limited lazy matches */
+/* 5 */ {8,   16, 32,   32, deflate_medium},
+/* 6 */ {8,   16, 128, 128, deflate_medium},
+/* 7 */ {8,   32, 128, 256, deflate_slow},  /* lazy matches */
 /* 8 */ {32, 128, 258, 1024, deflate_slow},
-/* 9 */ {32, 258, 258, 4096, deflate_slow}}; /* max compression */
+/* 9 */ {32, 258, 258, 4096, deflate_slow}, /* max compression */
+
+/* 10 */ {1,  258, 258, 1024, deflate_optimal}, /* optimal parsing */
+/* 11 */ {2,  258, 258, 2048, deflate_optimal},
+/* 12 */ {3,  258, 258, 4096, deflate_optimal}};
 #endif
 
 /* Note: the deflate() code requires max_lazy >= MIN_MATCH and max_chain >= 4
  * For deflate_fast() (levels <= 3) good is ignored and lazy has a different
- * meaning.
+ * meaning.  deflate_medium() (levels 4 to 6) uses lazy in both meanings.
+ * For deflate_optimal() (levels 10 to 12) lazy is ignored and good is the
+ * number of times the parse is refined with the costs of the previous one.
  */
 
+/* Matches and costs for deflate_optimal(), allocated for levels 10 to 12 */
+#define OPT_CHUNK 4096          /* bytes parsed at a time */
+#define OPT_MATCHES 8           /* matches kept at each position */
+
+struct opt_s {
+    unsigned chunk;                     /* bytes parsed but not yet sent */
+    uch count[OPT_CHUNK];               /* number of matches at each byte */
+    ush len[OPT_CHUNK][OPT_MATCHES];    /* their lengths, increasing */
+    ush dist[OPT_CHUNK][OPT_MATCHES];   /* and their distances */
+    ulg cost[OPT_CHUNK+1];              /* bits from each byte to the end */
+    ush choice[OPT_CHUNK];              /* length sent there, 1 for literal */
+    ush choice_dist[OPT_CHUNK];         /* and its distance */
+    ush prev_choice[OPT_CHUNK];         /* the parse before, to go back to */
+    ush prev_dist[OPT_CHUNK];
+    unsigned lfreq[L_CODES];            /* literal and length code counts */
+    unsigned dfreq[D_CODES];            /* distance code counts */
+    uch lcost[L_CODES];                 /* bits for each literal or length */
+    uch dcost[D_CODES];                 /* bits for each distance code */
+};
+
 #define EQUAL 0
 /* result of memcmp for equal strings */
 
@@ -166,6 +230,37 @@ struct static_tree_desc_s {int dummy;}; /* for buggy compilers */
  */
 #define UPDATE_HASH(s,h,c) (h = (((h)<<s->hash_shift) ^ (c)) & s->hash_mask)
 
+/* ===========================================================================
+ * Set ins_h to the hash of the string at window[str].  With the rolling hash,
+ * ins_h must hold the hash of the string at str-1, and the byte at
+ * str+MIN_MATCH-1 is added to it.  With Z_HASH_FOUR, the four bytes at str
+ * are multiplied by a large odd constant, and the top hash_bits bits of the
+ * low 32 bits of the product are the hash.  Every byte then affects the whole
+ * hash, so strings that only share their first three bytes do not share a
+ * hash chain.  Since the byte after a three-byte string would be stale, a
+ * string is hashed only when MIN_MATCH + hash_four bytes of it are in the
+ * window.
+ */
+#define HASH4(s, str) \
+   ((uInt)((((ulg)s->window[(str)] | ((ulg)s->window[(str)+1] << 8) | \
+             ((ulg)s->window[(str)+2] << 16) | \
+             ((ulg)s->window[(str)+3] << 24)) * 2654435761UL & \
+            0xffffffffUL) >> (32 - s->hash_bits)))
+
+#define HASH_STRING(s, str) \
+   (s->hash_four ? (s->ins_h = HASH4(s, str)) : \
+    UPDATE_HASH(s, s->ins_h, s->window[(str) + (MIN_MATCH-1)]))
+
+/* ===========================================================================
+ * Return the hash of the string at window[str] without using ins_h, for
+ * deflate_quick(), which does not hash every string.  The result is the same
+ * as that of HASH_STRING().
+ */
+#define HASH_FRESH(s, str) \
+   (s->hash_four ? HASH4(s, str) : \
+    ((((uInt)s->window[(str)] << (s->hash_shift << 1)) ^ \
+      ((uInt)s->window[(str)+1] << s->hash_shift) ^ \
+      s->window[(str)+2]) & s->hash_mask))
 
 /* ===========================================================================
  * Insert string str in the dictionary and set match_head to the previous head
@@ -179,16 +274,22 @@ struct static_tree_desc_s {int dummy;}; /* for buggy compilers */
  */
 #ifdef FASTEST
 #define INSERT_STRING(s, str, match_head) \
-   (UPDATE_HASH(s, s->ins_h, s->window[(str) + (MIN_MATCH-1)]), \
+   (HASH_STRING(s, str), \
     match_head = s->head[s->ins_h], \
     s->head[s->ins_h] = (Pos)(str))
 #else
 #define INSERT_STRING(s, str, match_head) \
-   (UPDATE_HASH(s, s->ins_h, s->window[(str) + (MIN_MATCH-1)]), \
+   (HASH_STRING(s, str), \
     match_head = s->prev[(str) & s->w_mask] = s->head[s->ins_h], \
     s->head[s->ins_h] = (Pos)(str))
 #endif
 
+/* ===========================================================================
+ * The longest match whose strings are inserted in the hash table, which is
+ * insert_limit if deflateInsertLimit() set it, or else dflt.
+ */
+#define MAX_INSERT(s, dflt) ((s)->insert_limit ? (s)->insert_limit : (dflt))
+
 /* ===========================================================================
  * Initialize the hash table (avoiding 64K overflow for 16 bit systems).
  * prev[] will be initialized on the fly.
@@ -268,12 +369,14 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
         windowBits -= 16;
     }
 #endif
-    if (memLevel < 1 || memLevel > MAX_MEM_LEVEL || method != Z_DEFLATED ||
-        windowBits < 8 || windowBits > 15 || level < 0 || level > 9 ||
-        strategy < 0 || strategy > Z_FIXED) {
+    if (memLevel < 1 || memLevel > MAX_HASH_LEVEL || method != Z_DEFLATED ||
+        windowBits < 8 || windowBits > 15 || level < 0 ||
+        level > Z_OPTIMAL_COMPRESSION ||
+        strategy < 0 || strategy > Z_QUICK) {
         return Z_STREAM_ERROR;
     }
     if (windowBits == 8) windowBits = 9;  /* until 256-byte window bug fixed */
+    Z_KERNELS_INIT();
     s = (deflate_state *) ZALLOC(strm, 1, sizeof(deflate_state));
     if (s == Z_NULL) return Z_MEM_ERROR;
     strm->state = (struct internal_state FAR *)s;
@@ -289,6 +392,8 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
     s->hash_size = 1 << s->hash_bits;
     s->hash_mask = s->hash_size - 1;
     s->hash_shift =  ((s->hash_bits+MIN_MATCH-1)/MIN_MATCH);
+    s->hash_four = 0;
+    s->insert_limit = 0;
 
     s->window = (Bytef *) ZALLOC(strm, s->w_size, 2*sizeof(Byte));
     s->prev   = (Posf *)  ZALLOC(strm, s->w_size, sizeof(Pos));
@@ -296,14 +401,25 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
 
     s->high_water = 0;      /* nothing written to s->window yet */
 
-    s->lit_bufsize = 1 << (memLevel + 6); /* 16K elements by default */
+    /* Above MAX_MEM_LEVEL, only the hash table grows.  The symbol buffer
+     * stays at the size that keeps the symbol counts in a ush.
+     */
+    s->lit_bufsize = 1 << ((memLevel < MAX_MEM_LEVEL ? memLevel :
+                            MAX_MEM_LEVEL) + 6); /* 16K elements by default */
 
     overlay = (ushf *) ZALLOC(strm, s->lit_bufsize, sizeof(ush)+2);
     s->pending_buf = (uchf *) overlay;
     s->pending_buf_size = (ulg)s->lit_bufsize * (sizeof(ush)+2L);
 
+    s->opt = Z_NULL;
+#ifndef FASTEST
+    if (level > Z_BEST_COMPRESSION)
+        s->opt = (struct opt_s FAR *) ZALLOC(strm, 1, sizeof(struct opt_s));
+#endif
+
     if (s->window == Z_NULL || s->prev == Z_NULL || s->head == Z_NULL ||
-        s->pending_buf == Z_NULL) {
+        s->pending_buf == Z_NULL ||
+        (level > Z_BEST_COMPRESSION && s->opt == Z_NULL)) {
         s->status = FINISH_STATE;
         strm->msg = ERR_MSG(Z_MEM_ERROR);
         deflateEnd (strm);
@@ -361,19 +477,12 @@ int ZEXPORT deflateSetDictionary (strm, dictionary, dictLength)
     strm->avail_in = dictLength;
     strm->next_in = (z_const Bytef *)dictionary;
     fill_window(s);
-    while (s->lookahead >= MIN_MATCH) {
+    while (s->lookahead >= MIN_MATCH + s->hash_four) {
         str = s->strstart;
-        n = s->lookahead - (MIN_MATCH-1);
-        do {
-            UPDATE_HASH(s, s->ins_h, s->window[str + MIN_MATCH-1]);
-#ifndef FASTEST
-            s->prev[str & s->w_mask] = s->head[s->ins_h];
-#endif
-            s->head[s->ins_h] = (Pos)str;
-            str++;
-        } while (--n);
-        s->strstart = str;
-        s->lookahead = MIN_MATCH-1;
+        n = s->lookahead - (MIN_MATCH-1 + s->hash_four);
+        insert_run(s, str, n);
+        s->strstart = str + n;
+        s->lookahead = MIN_MATCH-1 + s->hash_four;
         fill_window(s);
     }
     s->strstart += s->lookahead;
@@ -453,10 +562,11 @@ int ZEXPORT deflatePending (strm, pending, bits)
     z_streamp strm;
 {
     if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
+    /* Whole bytes still in the bit buffer are counted as pending bytes. */
     if (pending != Z_NULL)
-        *pending = strm->state->pending;
+        *pending = strm->state->pending + (strm->state->bi_valid >> 3);
     if (bits != Z_NULL)
-        *bits = strm->state->bi_valid;
+        *bits = strm->state->bi_valid & 7;
     return Z_OK;
 }
 
@@ -471,13 +581,14 @@ int ZEXPORT deflatePrime (strm, bits, value)
 
     if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
     s = strm->state;
-    if ((Bytef *)(s->d_buf) < s->pending_out + ((Buf_size + 7) >> 3))
+    if (bits < 0 || bits > 16 ||
+        (Bytef *)(s->d_buf) < s->pending_out + ((Buf_size + 7) >> 3))
         return Z_BUF_ERROR;
     do {
         put = Buf_size - s->bi_valid;
         if (put > bits)
             put = bits;
-        s->bi_buf |= (ush)((value & ((1 << put) - 1)) << s->bi_valid);
+        s->bi_buf |= (bi_word)(value & ((1 << put) - 1)) << s->bi_valid;
         s->bi_valid += put;
         _tr_flush_bits(s);
         value >>= put;
@@ -504,9 +615,17 @@ int ZEXPORT deflateParams(strm, level, strategy)
 #else
     if (level == Z_DEFAULT_COMPRESSION) level = 6;
 #endif
-    if (level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED) {
+    if (level < 0 || level > Z_OPTIMAL_COMPRESSION ||
+        strategy < 0 || strategy > Z_QUICK) {
         return Z_STREAM_ERROR;
     }
+#ifndef FASTEST
+    if (level > Z_BEST_COMPRESSION && s->opt == Z_NULL) {
+        s->opt = (struct opt_s FAR *) ZALLOC(strm, 1, sizeof(struct opt_s));
+        if (s->opt == Z_NULL) return Z_MEM_ERROR;
+        s->opt->chunk = 0;
+    }
+#endif
     func = configuration_table[s->level].func;
 
     if ((strategy != s->strategy || func != configuration_table[level].func) &&
@@ -515,7 +634,20 @@ int ZEXPORT deflateParams(strm, level, strategy)
         err = deflate(strm, Z_BLOCK);
         if (err == Z_BUF_ERROR && s->pending == 0)
             err = Z_OK;
+
+        /* An open Z_QUICK block, or symbols or stored data held for the next
+           block, would be lost by the switch, as would lookahead at level 0,
+           which deflate_stored() does not keep -- wait for more output space */
+        if (s->block_open || s->last_lit != 0 || s->match_available ||
+            ((s->raw || s->level == 0) &&
+             (long)s->strstart != s->block_start) ||
+            (level == 0 && s->lookahead != 0) ||
+            (s->opt != Z_NULL && s->opt->chunk != 0))
+            return Z_BUF_ERROR;
     }
+    if ((s->level == 0 && level != 0) ||
+        (s->strategy == Z_HUFFMAN_ONLY && strategy != Z_HUFFMAN_ONLY))
+        fix_hash(s);
     if (s->level != level) {
         s->level = level;
         s->max_lazy_match   = configuration_table[level].max_lazy;
@@ -546,6 +678,39 @@ int ZEXPORT deflateTune(strm, good_length, max_lazy, nice_length, max_chain)
     return Z_OK;
 }
 
+/* ========================================================================= */
+int ZEXPORT deflateHash(strm, hash)
+    z_streamp strm;
+    int hash;
+{
+    deflate_state *s;
+
+    if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
+    s = strm->state;
+    if ((hash != Z_HASH_ROLLING && hash != Z_HASH_FOUR) ||
+        s->strstart != 0 || s->lookahead != 0)
+        return Z_STREAM_ERROR;
+#ifdef ASMV
+    /* The assembler longest_match() does not compare the third byte of the
+       strings, which only the rolling hash assures matches */
+    if (hash == Z_HASH_FOUR)
+        return Z_STREAM_ERROR;
+#endif
+    s->hash_four = hash == Z_HASH_FOUR;
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateInsertLimit(strm, limit)
+    z_streamp strm;
+    int limit;
+{
+    if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
+    if (limit < 0 || limit > MAX_MATCH) return Z_STREAM_ERROR;
+    strm->state->insert_limit = (uInt)limit;
+    return Z_OK;
+}
+
 /* =========================================================================
  * For the default windowBits of 15 and memLevel of 8, this function returns
  * a close to exact, as well as small, upper bound on the compressed size.
@@ -611,8 +776,9 @@ uLong ZEXPORT deflateBound(strm, sourceLen)
         wraplen = 6;
     }
 
-    /* if not default parameters, return conservative bound */
-    if (s->w_bits != 15 || s->hash_bits != 8 + 7)
+    /* if not default parameters, return conservative bound -- Z_QUICK sends
+       up to nine bits per byte, which is within it */
+    if (s->w_bits != 15 || s->hash_bits != 8 + 7 || s->strategy == Z_QUICK)
         return complen + wraplen;
 
     /* default settings: return tight bound for that case */
@@ -700,7 +866,7 @@ int ZEXPORT deflate (strm, flush)
                 put_byte(s, 0);
                 put_byte(s, 0);
                 put_byte(s, 0);
-                put_byte(s, s->level == 9 ? 2 :
+                put_byte(s, s->level >= 9 ? 2 :
                             (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2 ?
                              4 : 0));
                 put_byte(s, OS_CODE);
@@ -717,7 +883,7 @@ int ZEXPORT deflate (strm, flush)
                 put_byte(s, (Byte)((s->gzhead->time >> 8) & 0xff));
                 put_byte(s, (Byte)((s->gzhead->time >> 16) & 0xff));
                 put_byte(s, (Byte)((s->gzhead->time >> 24) & 0xff));
-                put_byte(s, s->level == 9 ? 2 :
+                put_byte(s, s->level >= 9 ? 2 :
                             (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2 ?
                              4 : 0));
                 put_byte(s, s->gzhead->os & 0xff);
@@ -899,10 +1065,20 @@ int ZEXPORT deflate (strm, flush)
     if (strm->avail_in != 0 || s->lookahead != 0 ||
         (flush != Z_NO_FLUSH && s->status != FINISH_STATE)) {
         block_state bstate;
+        int raw;
 
-        bstate = s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
-                    (s->strategy == Z_RLE ? deflate_rle(s, flush) :
-                        (*(configuration_table[s->level].func))(s, flush));
+        /* Switch between deflate_raw() and the compression function for as
+         * long as they hand the input over to each other.
+         */
+        do {
+            raw = s->raw;
+            bstate = raw ? deflate_raw(s, flush) :
+                     s->level == 0 ? deflate_stored(s, flush) :
+                     s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
+                     s->strategy == Z_RLE ? deflate_rle(s, flush) :
+                     s->strategy == Z_QUICK ? deflate_quick(s, flush) :
+                        (*(configuration_table[s->level].func))(s, flush);
+        } while (bstate == need_more && s->raw != raw && strm->avail_out != 0);
 
         if (bstate == finish_started || bstate == finish_done) {
             s->status = FINISH_STATE;
@@ -995,6 +1171,7 @@ int ZEXPORT deflateEnd (strm)
     }
 
     /* Deallocate in reverse order of allocations: */
+    TRY_FREE(strm, strm->state->opt);
     TRY_FREE(strm, strm->state->pending_buf);
     TRY_FREE(strm, strm->state->head);
     TRY_FREE(strm, strm->state->prev);
@@ -1042,9 +1219,12 @@ int ZEXPORT deflateCopy (dest, source)
     ds->head   = (Posf *)  ZALLOC(dest, ds->hash_size, sizeof(Pos));
     overlay = (ushf *) ZALLOC(dest, ds->lit_bufsize, sizeof(ush)+2);
     ds->pending_buf = (uchf *) overlay;
+    ds->opt = Z_NULL;
+    if (ss->opt != Z_NULL)
+        ds->opt = (struct opt_s FAR *) ZALLOC(dest, 1, sizeof(struct opt_s));
 
     if (ds->window == Z_NULL || ds->prev == Z_NULL || ds->head == Z_NULL ||
-        ds->pending_buf == Z_NULL) {
+        ds->pending_buf == Z_NULL || (ss->opt != Z_NULL && ds->opt == Z_NULL)) {
         deflateEnd (dest);
         return Z_MEM_ERROR;
     }
@@ -1053,6 +1233,8 @@ int ZEXPORT deflateCopy (dest, source)
     zmemcpy((voidpf)ds->prev, (voidpf)ss->prev, ds->w_size * sizeof(Pos));
     zmemcpy((voidpf)ds->head, (voidpf)ss->head, ds->hash_size * sizeof(Pos));
     zmemcpy(ds->pending_buf, ss->pending_buf, (uInt)ds->pending_buf_size);
+    if (ds->opt != Z_NULL)
+        zmemcpy((voidpf)ds->opt, (voidpf)ss->opt, sizeof(struct opt_s));
 
     ds->pending_out = ds->pending_buf + (ss->pending_out - ss->pending_buf);
     ds->d_buf = overlay + ds->lit_bufsize/sizeof(ush);
@@ -1071,7 +1253,8 @@ int ZEXPORT deflateCopy (dest, source)
  * and total number of bytes read.  All deflate() input goes through
  * this function so some applications may wish to modify it to avoid
  * allocating a large strm->next_in buffer and copying from it.
- * (See also flush_pending()).
+ * (See also flush_pending()).  If buf is Z_NULL, the input is checked and
+ * skipped without a copy.
  */
 local int read_buf(strm, buf, size)
     z_streamp strm;
@@ -1085,13 +1268,14 @@ local int read_buf(strm, buf, size)
 
     strm->avail_in  -= len;
 
-    zmemcpy(buf, strm->next_in, len);
+    if (buf != Z_NULL)
+        zmemcpy(buf, strm->next_in, len);
     if (strm->state->wrap == 1) {
-        strm->adler = adler32(strm->adler, buf, len);
+        strm->adler = adler32(strm->adler, strm->next_in, len);
     }
 #ifdef GZIP
     else if (strm->state->wrap == 2) {
-        strm->adler = crc32(strm->adler, buf, len);
+        strm->adler = crc32(strm->adler, strm->next_in, len);
     }
 #endif
     strm->next_in  += len;
@@ -1121,6 +1305,11 @@ local void lm_init (s)
     s->block_start = 0L;
     s->lookahead = 0;
     s->insert = 0;
+    s->block_open = 0;
+    s->raw = 0;
+    s->slides = 0;
+    if (s->opt != Z_NULL)
+        s->opt->chunk = 0;
     s->match_length = s->prev_length = MIN_MATCH-1;
     s->match_available = 0;
     s->ins_h = 0;
@@ -1141,11 +1330,11 @@ local void lm_init (s)
  *   string (strstart) and its distance is <= MAX_DIST, and prev_length >= 1
  * OUT assertion: the match length is not greater than s->lookahead.
  */
-#ifndef ASMV
+#if !defined(ASMV) && !defined(MATCH_WORD)
 /* For 80x86 and 680x0, an optimized version will be provided in match.asm or
  * match.S. The code will be functionally equivalent.
  */
-local uInt longest_match(s, cur_match)
+uInt ZLIB_INTERNAL longest_match(s, cur_match)
     deflate_state *s;
     IPos cur_match;                             /* current match */
 {
@@ -1209,18 +1398,19 @@ local uInt longest_match(s, cur_match)
          * UNALIGNED_OK if your compiler uses a different size.
          */
         if (*(ushf*)(match+best_len-1) != scan_end ||
-            *(ushf*)match != scan_start) continue;
+            *(ushf*)match != scan_start ||
+            match[2] != scan[2]) continue;
 
-        /* It is not necessary to compare scan[2] and match[2] since they are
-         * always equal when the other bytes match, given that the hash keys
-         * are equal and that HASH_BITS >= 8. Compare 2 bytes at a time at
+        /* scan[2] and match[2] are always equal when the other bytes match
+         * with the rolling hash, given that the hash keys are equal and that
+         * HASH_BITS >= 8, but not with the four-byte hash, so they are
+         * compared above. Compare 2 bytes at a time at
          * strstart+3, +5, ... up to strstart+257. We check for insufficient
          * lookahead only every 4th comparison; the 128th check will be made
          * at strstart+257. If MAX_MATCH-2 is not a multiple of 8, it is
          * necessary to put more guard bytes at the end of the window, or
          * to check more often for insufficient lookahead.
          */
-        Assert(scan[2] == match[2], "scan[2]?");
         scan++, match++;
         do {
         } while (*(ushf*)(scan+=2) == *(ushf*)(match+=2) &&
@@ -1242,16 +1432,16 @@ local uInt longest_match(s, cur_match)
         if (match[best_len]   != scan_end  ||
             match[best_len-1] != scan_end1 ||
             *match            != *scan     ||
-            *++match          != scan[1])      continue;
+            *++match          != scan[1]   ||
+            match[1]          != scan[2])      continue;
 
         /* The check at best_len-1 can be removed because it will be made
          * again later. (This heuristic is not always a win.)
-         * It is not necessary to compare scan[2] and match[2] since they
-         * are always equal when the other bytes match, given that
-         * the hash keys are equal and that HASH_BITS >= 8.
+         * scan[2] and match[2] are always equal when the other bytes match
+         * with the rolling hash, given that the hash keys are equal and that
+         * HASH_BITS >= 8, but not with the four-byte hash.
          */
         scan += 2, match++;
-        Assert(*scan == *match, "match[2]?");
 
         /* We check for insufficient lookahead only every 8th comparison;
          * the 256th check will be made at strstart+258.
@@ -1287,21 +1477,142 @@ local uInt longest_match(s, cur_match)
     if ((uInt)best_len <= s->lookahead) return (uInt)best_len;
     return s->lookahead;
 }
-#endif /* ASMV */
+#endif /* !ASMV && !MATCH_WORD */
+
+/* ===========================================================================
+ * The same search with the strings compared a word or a vector at a time.
+ * Each compare256 returns the number of leading bytes at a and b that are
+ * equal, out of 256, and match.h turns it into a longest_match().  These are
+ * only compiled for processors that load unaligned data quickly.
+ */
+#if defined(MATCH_WORD) || (defined(Z_X86_SIMD) && !defined(ASMV))
+local ush load16 OF((const Bytef *p));
+
+local ush load16(p)
+    const Bytef *p;
+{
+    ush v;
+
+    zmemcpy(&v, p, sizeof(v));
+    return v;
+}
+#  define LOAD16(p) load16(p)
+#endif
+
+#ifdef MATCH_WORD
+local unsigned compare256_word OF((const Bytef *a, const Bytef *b));
+
+local unsigned compare256_word(a, b)
+    const Bytef *a;
+    const Bytef *b;
+{
+    unsigned n = 0;
+    unsigned long long x, y;
+
+    do {
+        __builtin_memcpy(&x, a + n, sizeof(x));
+        __builtin_memcpy(&y, b + n, sizeof(y));
+        x ^= y;
+        if (x)
+#  if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            return n + ((unsigned)__builtin_ctzll(x) >> 3);
+#  else
+            return n + ((unsigned)__builtin_clzll(x) >> 3);
+#  endif
+        n += sizeof(x);
+    } while (n < 256);
+    return 256;
+}
+
+#  define LONGEST_MATCH longest_match
+#  define COMPARE256 compare256_word
+#  include "match.h"
+#endif /* MATCH_WORD */
+
+#if defined(Z_X86_SIMD) && !defined(ASMV)
+#  ifdef _MSC_VER
+local unsigned ctz32 OF((unsigned x));
+
+local unsigned ctz32(x)
+    unsigned x;
+{
+    unsigned long n;
+
+    _BitScanForward(&n, x);
+    return (unsigned)n;
+}
+#  else
+#    define ctz32(x) ((unsigned)__builtin_ctz(x))
+#  endif
+
+local unsigned compare256_sse2 OF((const Bytef *a, const Bytef *b))
+                               Z_TARGET("sse2");
+local unsigned compare256_avx2 OF((const Bytef *a, const Bytef *b))
+                               Z_TARGET("avx2");
+
+local unsigned compare256_sse2(a, b)
+    const Bytef *a;
+    const Bytef *b;
+{
+    unsigned n = 0, mask;
+
+    do {
+        mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+                   _mm_loadu_si128((const __m128i *)(a + n)),
+                   _mm_loadu_si128((const __m128i *)(b + n))));
+        if (mask != 0xffff)
+            return n + ctz32(~mask);
+        n += 16;
+    } while (n < 256);
+    return 256;
+}
+
+local unsigned compare256_avx2(a, b)
+    const Bytef *a;
+    const Bytef *b;
+{
+    unsigned n = 0, mask;
+
+    do {
+        mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                   _mm256_loadu_si256((const __m256i *)(a + n)),
+                   _mm256_loadu_si256((const __m256i *)(b + n))));
+        if (mask != 0xffffffff)
+            return n + ctz32(~mask);
+        n += 32;
+    } while (n < 256);
+    return 256;
+}
+
+#  define LONGEST_MATCH longest_match_sse2
+#  define COMPARE256 compare256_sse2
+#  include "match.h"
 
-#else /* FASTEST */
+#  define LONGEST_MATCH longest_match_avx2
+#  define COMPARE256 compare256_avx2
+#  include "match.h"
+#endif /* Z_X86_SIMD && !ASMV */
+
+#endif /* !FASTEST */
 
 /* ---------------------------------------------------------------------------
- * Optimized version for FASTEST only
+ * Optimized version for FASTEST, and for Z_QUICK: check only the one string
+ * at cur_match.
  */
-local uInt longest_match(s, cur_match)
+#ifdef FASTEST
+uInt ZLIB_INTERNAL longest_match(s, cur_match)
+#else
+local uInt quick_match(s, cur_match)
+#endif
     deflate_state *s;
     IPos cur_match;                             /* current match */
 {
     register Bytef *scan = s->window + s->strstart; /* current string */
     register Bytef *match;                       /* matched string */
     register int len;                           /* length of current match */
+#ifndef MATCH_WORD
     register Bytef *strend = s->window + s->strstart + MAX_MATCH;
+#endif
 
     /* The code is optimized for HASH_BITS >= 8 and MAX_MATCH-2 multiple of 16.
      * It is easy to get rid of this optimization if necessary.
@@ -1316,16 +1627,19 @@ local uInt longest_match(s, cur_match)
 
     /* Return failure if the match length is less than 2:
      */
-    if (match[0] != scan[0] || match[1] != scan[1]) return MIN_MATCH-1;
+    if (match[0] != scan[0] || match[1] != scan[1] || match[2] != scan[2])
+        return MIN_MATCH-1;
 
-    /* The check at best_len-1 can be removed because it will be made
-     * again later. (This heuristic is not always a win.)
-     * It is not necessary to compare scan[2] and match[2] since they
-     * are always equal when the other bytes match, given that
-     * the hash keys are equal and that HASH_BITS >= 8.
+    /* scan[2] and match[2] are always equal when the other bytes match with
+     * the rolling hash, given that the hash keys are equal and that
+     * HASH_BITS >= 8, but not with the four-byte hash.
      */
+#ifdef MATCH_WORD
+    /* Compare the rest a word at a time, as longest_match() does */
+    len = 3 + (int)compare256_word(scan + 3, match + 3);
+    if (len > MAX_MATCH) len = MAX_MATCH;
+#else
     scan += 2, match += 2;
-    Assert(*scan == *match, "match[2]?");
 
     /* We check for insufficient lookahead only every 8th comparison;
      * the 256th check will be made at strstart+258.
@@ -1342,13 +1656,12 @@ local uInt longest_match(s, cur_match)
     len = MAX_MATCH - (int)(strend - scan);
 
     if (len < MIN_MATCH) return MIN_MATCH - 1;
+#endif
 
     s->match_start = cur_match;
     return (uInt)len <= s->lookahead ? (uInt)len : s->lookahead;
 }
 
-#endif /* FASTEST */
-
 #ifdef DEBUG
 /* ===========================================================================
  * Check that the match at match_start is indeed a match.
@@ -1377,11 +1690,166 @@ local void check_match(s, start, match, length)
 #  define check_match(s, start, match, length)
 #endif /* DEBUG */
 
+/* ===========================================================================
+ * Slide the hash table down by w_size when the window slides: entries that
+ * would fall out of the window become NIL.
+ */
+void ZLIB_INTERNAL slide_hash_generic(s)
+    deflate_state *s;
+{
+    register unsigned n, m;
+    register Posf *p;
+    uInt wsize = s->w_size;
+
+    n = s->hash_size;
+    p = &s->head[n];
+    do {
+        m = *--p;
+        *p = (Pos)(m >= wsize ? m-wsize : NIL);
+    } while (--n);
+
+#ifndef FASTEST
+    n = wsize;
+    p = &s->prev[n];
+    do {
+        m = *--p;
+        *p = (Pos)(m >= wsize ? m-wsize : NIL);
+        /* If n is not on any hash chain, prev[n] is garbage but
+         * its value will never be used.
+         */
+    } while (--n);
+#endif
+}
+
+#ifdef Z_X86_SIMD
+/* ---------------------------------------------------------------------------
+ * The same with vectors of Pos.  An unsigned saturating subtraction of wsize
+ * gives m-wsize for m >= wsize and 0, which is NIL, below it.  hash_size and
+ * w_size are multiples of 256, so there is nothing left over.
+ */
+void ZLIB_INTERNAL slide_hash_sse2(s)
+    deflate_state *s;
+{
+    unsigned n;
+    Posf *p;
+    __m128i wsize = _mm_set1_epi16((short)s->w_size);
+
+    n = s->hash_size;
+    p = s->head;
+    do {
+        _mm_storeu_si128((__m128i *)p,
+                         _mm_subs_epu16(_mm_loadu_si128((__m128i *)p), wsize));
+        p += 8;
+    } while (n -= 8);
+
+#ifndef FASTEST
+    n = s->w_size;
+    p = s->prev;
+    do {
+        _mm_storeu_si128((__m128i *)p,
+                         _mm_subs_epu16(_mm_loadu_si128((__m128i *)p), wsize));
+        p += 8;
+    } while (n -= 8);
+#endif
+}
+
+void ZLIB_INTERNAL slide_hash_avx2(s)
+    deflate_state *s;
+{
+    unsigned n;
+    Posf *p;
+    __m256i wsize = _mm256_set1_epi16((short)s->w_size);
+
+    n = s->hash_size;
+    p = s->head;
+    do {
+        _mm256_storeu_si256((__m256i *)p,
+                    _mm256_subs_epu16(_mm256_loadu_si256((__m256i *)p), wsize));
+        p += 16;
+    } while (n -= 16);
+
+#ifndef FASTEST
+    n = s->w_size;
+    p = s->prev;
+    do {
+        _mm256_storeu_si256((__m256i *)p,
+                    _mm256_subs_epu16(_mm256_loadu_si256((__m256i *)p), wsize));
+        p += 16;
+    } while (n -= 16);
+#endif
+}
+#endif /* Z_X86_SIMD */
+
+/* ===========================================================================
+ * Insert the count strings starting at window[str] in the hash table, as
+ * count INSERT_STRING()s would, for the strings inside a match, which are
+ * most of them on redundant data.  ins_h and the table pointers are kept in
+ * registers across the run instead of being reloaded for each string, and
+ * the test for the hash is made once.  The updates of head and prev, not the
+ * hash, take most of the time, so the hashes are not computed ahead.
+ * IN assertion: count > 0, and ins_h is the hash of the string at str-1 when
+ *    the rolling hash is used.
+ */
+local void insert_run(s, str, count)
+    deflate_state *s;
+    uInt str;
+    uInt count;
+{
+    Posf *head = s->head;
+#ifndef FASTEST
+    Posf *prev = s->prev;
+    uInt wmask = s->w_mask;
+#endif
+    Bytef *window = s->window;
+    uInt h = s->ins_h;
+    uInt mask = s->hash_mask;
+    uInt shift = s->hash_shift;
+
+    if (s->hash_four) {
+        do {
+            h = HASH4(s, str);
+#ifndef FASTEST
+            prev[str & wmask] = head[h];
+#endif
+            head[h] = (Pos)str;
+            str++;
+        } while (--count);
+    }
+    else {
+        do {
+            h = ((h << shift) ^ window[str + (MIN_MATCH-1)]) & mask;
+#ifndef FASTEST
+            prev[str & wmask] = head[h];
+#endif
+            head[h] = (Pos)str;
+            str++;
+        } while (--count);
+    }
+    s->ins_h = h;
+}
+
+/* ===========================================================================
+ * Do the slides of the hash table that deflate_stored() or deflate_huff() left
+ * undone when they slid the window, or clear the table if the whole window was
+ * replaced, so that the table can be used for matches again.
+ */
+local void fix_hash(s)
+    deflate_state *s;
+{
+    if (s->slides == 1)
+        z_kernels.slide_hash(s);
+    else if (s->slides)
+        CLEAR_HASH(s);
+    s->slides = 0;
+}
+
 /* ===========================================================================
  * Fill the window when the lookahead becomes insufficient.
  * Updates strstart and lookahead.
  *
- * IN assertion: lookahead < MIN_LOOKAHEAD
+ * IN assertion: lookahead < MIN_LOOKAHEAD, or for deflate_optimal(), which
+ *    reads ahead a chunk at a time, there are at least two bytes free at the
+ *    end of the window
  * OUT assertions: strstart <= window_size-MIN_LOOKAHEAD
  *    At least one byte has been read, or avail_in == 0; reads are
  *    performed for at least two bytes (required for the zip translate_eol
@@ -1390,12 +1858,13 @@ local void check_match(s, start, match, length)
 local void fill_window(s)
     deflate_state *s;
 {
-    register unsigned n, m;
-    register Posf *p;
+    unsigned n;
     unsigned more;    /* Amount of free space at the end of the window. */
     uInt wsize = s->w_size;
 
-    Assert(s->lookahead < MIN_LOOKAHEAD, "already enough lookahead");
+    Assert(s->lookahead < MIN_LOOKAHEAD ||
+           s->strstart + s->lookahead + 2 <= s->window_size,
+           "already enough lookahead");
 
     do {
         more = (unsigned)(s->window_size -(ulg)s->lookahead -(ulg)s->strstart);
@@ -1422,31 +1891,15 @@ local void fill_window(s)
             s->match_start -= wsize;
             s->strstart    -= wsize; /* we now have strstart >= MAX_DIST */
             s->block_start -= (long) wsize;
+            if (s->insert > s->strstart)
+                s->insert = s->strstart;
 
             /* Slide the hash table (could be avoided with 32 bit values
-               at the expense of memory usage). We slide even when level == 0
-               to keep the hash table consistent if we switch back to level > 0
-               later. (Using level 0 permanently is not an optimal usage of
-               zlib, so we don't care about this pathological case.)
+               at the expense of memory usage). deflate_stored() and
+               deflate_huff() do not come here, and leave their slides to
+               fix_hash().
              */
-            n = s->hash_size;
-            p = &s->head[n];
-            do {
-                m = *--p;
-                *p = (Pos)(m >= wsize ? m-wsize : NIL);
-            } while (--n);
-
-            n = wsize;
-#ifndef FASTEST
-            p = &s->prev[n];
-            do {
-                m = *--p;
-                *p = (Pos)(m >= wsize ? m-wsize : NIL);
-                /* If n is not on any hash chain, prev[n] is garbage but
-                 * its value will never be used.
-                 */
-            } while (--n);
-#endif
+            z_kernels.slide_hash(s);
             more += wsize;
         }
         if (s->strm->avail_in == 0) break;
@@ -1467,8 +1920,11 @@ local void fill_window(s)
         n = read_buf(s->strm, s->window + s->strstart + s->lookahead, more);
         s->lookahead += n;
 
-        /* Initialize the hash value now that we have some input: */
-        if (s->lookahead + s->insert >= MIN_MATCH) {
+        /* Initialize the hash value now that we have some input.  The four
+         * byte hash is not computed until all four bytes are here, since the
+         * bytes after the input may not have been written yet.
+         */
+        if (s->lookahead + s->insert >= MIN_MATCH + s->hash_four) {
             uInt str = s->strstart - s->insert;
             s->ins_h = s->window[str];
             UPDATE_HASH(s, s->ins_h, s->window[str + 1]);
@@ -1476,14 +1932,14 @@ local void fill_window(s)
             Call UPDATE_HASH() MIN_MATCH-3 more times
 #endif
             while (s->insert) {
-                UPDATE_HASH(s, s->ins_h, s->window[str + MIN_MATCH-1]);
+                HASH_STRING(s, str);
 #ifndef FASTEST
                 s->prev[str & s->w_mask] = s->head[s->ins_h];
 #endif
                 s->head[s->ins_h] = (Pos)str;
                 str++;
                 s->insert--;
-                if (s->lookahead + s->insert < MIN_MATCH)
+                if (s->lookahead + s->insert < MIN_MATCH + s->hash_four)
                     break;
             }
         }
@@ -1546,111 +2002,413 @@ local void fill_window(s)
    Tracev((stderr,"[FLUSH]")); \
 }
 
-/* Same but force premature exit if necessary. */
+/* Same but force premature exit if necessary, or to have deflate() go on
+ * with deflate_raw() if the block was stored.
+ */
 #define FLUSH_BLOCK(s, last) { \
    FLUSH_BLOCK_ONLY(s, last); \
    if (s->strm->avail_out == 0) return (last) ? finish_started : need_more; \
+   if (s->raw && !(last)) return need_more; \
 }
 
 /* ===========================================================================
  * Copy without compression as much as possible from the input stream, return
  * the current block state.
- * This function does not insert new strings in the dictionary since
- * uncompressible data is probably not useful. This function is used
- * only for the level=0 compression option.
- * NOTE: this function should be optimized to avoid extra copying from
- * window to pending_buf.
+ *
+ * In case deflateParams() is used to later switch to a non-zero compression
+ * level, s->slides is set to 1 if the window slid once and the hash table
+ * has not been slid to match, or to 2 if it should be cleared instead (the
+ * window was replaced, or slid more than once).  fix_hash() takes care of
+ * it.  The strings are not inserted in the hash table, but s->insert counts
+ * those at the end of the window for fill_window() to insert.
+ *
+ * deflate_stored() is written to minimize the number of times an input byte
+ * is copied.  It is most efficient with large input and output buffers,
+ * which maximizes the opportunities to have a single copy from next_in to
+ * next_out: the stored block headers are written to pending and flushed,
+ * and then the data goes straight to the output.  The window is kept only
+ * for the last w_size bytes of each call, for a later level change or
+ * dictionary.  Otherwise the input goes through the window and pending_buf
+ * as before.  This function is used for level 0, and by deflate_raw().
+ */
+#define MAX_STORED 65535    /* largest stored block length */
+
+#define MIN(a, b) ((a) > (b) ? (b) : (a))
+
+/* ===========================================================================
+ * Update the sliding window with the last s->w_size bytes of the used bytes
+ * at buf, which were taken from next_in without going through the window, or
+ * append all of them to the existing window if there are fewer.  Also update
+ * the number of bytes to insert in the hash table, in the event that
+ * deflateParams() switches to a function that looks for matches.
+ * IN assertion: no input is left in the window, and s->block_start ==
+ *    s->strstart.
  */
+local void keep_window(s, buf, used)
+    deflate_state *s;
+    const Bytef *buf;
+    unsigned used;
+{
+    if (used >= s->w_size) {    /* supplant the previous history */
+        s->slides = 2;          /* clear hash */
+        zmemcpy(s->window, buf + used - s->w_size, s->w_size);
+        s->strstart = s->w_size;
+        s->insert = s->strstart;
+    }
+    else {
+        if (s->window_size - s->strstart <= used) {
+            /* Slide the window down. */
+            s->strstart -= s->w_size;
+            zmemcpy(s->window, s->window + s->w_size, s->strstart);
+            if (s->slides < 2)
+                s->slides++;    /* add a pending slide_hash() */
+            if (s->insert > s->strstart)
+                s->insert = s->strstart;
+        }
+        zmemcpy(s->window + s->strstart, buf, used);
+        s->strstart += used;
+        s->insert += MIN(used, s->w_size - s->insert);
+    }
+    s->block_start = s->strstart;
+    if (s->high_water < s->strstart)
+        s->high_water = s->strstart;
+}
+
 local block_state deflate_stored(s, flush)
     deflate_state *s;
     int flush;
 {
-    /* Stored blocks are limited to 0xffff bytes, pending_buf is limited
-     * to pending_buf_size, and each stored block has a 5 byte header:
+    /* Smallest worthy block size when not flushing or finishing.  By default
+     * this is 32K.  This can be as small as 507 bytes for memLevel == 1.  For
+     * large input and output buffers, the stored block size will be larger.
      */
-    ulg max_block_size = 0xffff;
-    ulg max_start;
-
-    if (max_block_size > s->pending_buf_size - 5) {
-        max_block_size = s->pending_buf_size - 5;
-    }
+    unsigned min_block = MIN(s->pending_buf_size - 5, s->w_size);
 
-    /* Copy as much as possible from input to output: */
-    for (;;) {
-        /* Fill the window as much as possible: */
-        if (s->lookahead <= 1) {
+    /* Copy as many min_block or larger stored blocks directly to next_out as
+     * possible.  If flushing, copy the remaining available input to next_out
+     * as stored blocks, if there is enough space.
+     */
+    unsigned len, left, have, last = 0;
+    unsigned used = s->strm->avail_in;
+    do {
+        /* Set len to the maximum size block that we can copy directly with
+         * the available input data and output space.  Set left to how much
+         * of that would be copied from what's left in the window.
+         */
+        len = MAX_STORED;
+        have = (s->bi_valid + 42) >> 3;         /* number of header bytes */
+        if (s->strm->avail_out < have)          /* need room for header */
+            break;
+            /* maximum stored block length that will fit in avail_out: */
+        have = s->strm->avail_out - have;
+        left = s->strstart - s->block_start;    /* bytes left in window */
+        if (len > (ulg)left + s->strm->avail_in)
+            len = left + s->strm->avail_in;     /* limit len to the input */
+        if (len > have)
+            len = have;                         /* limit len to the output */
+
+        /* If the stored block would be less than min_block in length, or if
+         * unable to copy all of the available input when flushing, then try
+         * copying to the window and the pending buffer instead.  Also don't
+         * write an empty block when flushing -- deflate() does that.
+         */
+        if (len < min_block && ((len == 0 && flush != Z_FINISH) ||
+                                flush == Z_NO_FLUSH ||
+                                len != left + s->strm->avail_in))
+            break;
 
-            Assert(s->strstart < s->w_size+MAX_DIST(s) ||
-                   s->block_start >= (long)s->w_size, "slide too late");
+        /* Make a dummy stored block in pending to get the header bytes,
+         * including any pending bits.  This also updates the debugging counts.
+         */
+        last = flush == Z_FINISH && len == left + s->strm->avail_in ? 1 : 0;
+        _tr_stored_block(s, (char *)0, 0L, last);
 
-            fill_window(s);
-            if (s->lookahead == 0 && flush == Z_NO_FLUSH) return need_more;
+        /* Replace the lengths in the dummy stored block with len. */
+        s->pending_buf[s->pending - 4] = (Bytef)len;
+        s->pending_buf[s->pending - 3] = (Bytef)(len >> 8);
+        s->pending_buf[s->pending - 2] = (Bytef)~len;
+        s->pending_buf[s->pending - 1] = (Bytef)(~len >> 8);
 
-            if (s->lookahead == 0) break; /* flush the current block */
-        }
-        Assert(s->block_start >= 0L, "block gone");
+        /* Write the stored block header bytes. */
+        flush_pending(s->strm);
 
-        s->strstart += s->lookahead;
-        s->lookahead = 0;
+#ifdef DEBUG
+        /* Update debugging counts for the data about to be copied. */
+        s->compressed_len += (ulg)len << 3;
+        s->bits_sent += (ulg)len << 3;
+#endif
 
-        /* Emit a stored block if pending_buf will be full: */
-        max_start = s->block_start + max_block_size;
-        if (s->strstart == 0 || (ulg)s->strstart >= max_start) {
-            /* strstart == 0 is possible when wraparound on 16-bit machine */
-            s->lookahead = (uInt)(s->strstart - max_start);
-            s->strstart = (uInt)max_start;
-            FLUSH_BLOCK(s, 0);
+        /* Copy uncompressed bytes from the window to next_out. */
+        if (left) {
+            if (left > len)
+                left = len;
+            zmemcpy(s->strm->next_out, s->window + s->block_start, left);
+            s->strm->next_out += left;
+            s->strm->avail_out -= left;
+            s->strm->total_out += left;
+            s->block_start += left;
+            len -= left;
         }
-        /* Flush if we may have to slide, otherwise block_start may become
-         * negative and the data will be gone:
+
+        /* Copy uncompressed bytes directly from next_in to next_out, updating
+         * the check value.
          */
-        if (s->strstart - (uInt)s->block_start >= MAX_DIST(s)) {
-            FLUSH_BLOCK(s, 0);
+        if (len) {
+            read_buf(s->strm, s->strm->next_out, len);
+            s->strm->next_out += len;
+            s->strm->avail_out -= len;
+            s->strm->total_out += len;
         }
+    } while (last == 0);
+
+    /* Update the sliding window with the copied data.  If any input was used,
+     * then no unused input remains in the window, therefore s->block_start ==
+     * s->strstart.
+     */
+    used -= s->strm->avail_in;      /* number of input bytes directly copied */
+    if (used)
+        keep_window(s, s->strm->next_in - used, used);
+    if (s->high_water < s->strstart)
+        s->high_water = s->strstart;
+
+    /* If the last block was written to next_out, then done. */
+    if (last)
+        return finish_done;
+
+    /* If flushing and all input has been consumed, then done. */
+    if (flush != Z_NO_FLUSH && flush != Z_FINISH &&
+        s->strm->avail_in == 0 && (long)s->strstart == s->block_start)
+        return block_done;
+
+    /* Fill the window with any remaining input. */
+    have = s->window_size - s->strstart;
+    if (s->strm->avail_in > have && s->block_start >= (long)s->w_size) {
+        /* Slide the window down. */
+        s->block_start -= s->w_size;
+        s->strstart -= s->w_size;
+        zmemcpy(s->window, s->window + s->w_size, s->strstart);
+        if (s->slides < 2)
+            s->slides++;            /* add a pending slide_hash() */
+        have += s->w_size;          /* more space now */
+        if (s->insert > s->strstart)
+            s->insert = s->strstart;
+    }
+    if (have > s->strm->avail_in)
+        have = s->strm->avail_in;
+    if (have) {
+        read_buf(s->strm, s->window + s->strstart, have);
+        s->strstart += have;
+        s->insert += MIN(have, s->w_size - s->insert);
+    }
+    if (s->high_water < s->strstart)
+        s->high_water = s->strstart;
+
+    /* There was not enough avail_out to write a complete worthy or flushed
+     * stored block to next_out.  Write a stored block to pending instead, if
+     * we have enough input for a worthy block, or if flushing and there is
+     * enough room for the remaining input as a stored block in the pending
+     * buffer.
+     */
+    have = (s->bi_valid + 42) >> 3;         /* number of header bytes */
+        /* maximum stored block length that will fit in pending: */
+    have = MIN(s->pending_buf_size - have, MAX_STORED);
+    min_block = MIN(have, s->w_size);
+    left = s->strstart - s->block_start;
+    if (left >= min_block ||
+        ((left || flush == Z_FINISH) && flush != Z_NO_FLUSH &&
+         s->strm->avail_in == 0 && left <= have)) {
+        len = MIN(left, have);
+        last = flush == Z_FINISH && s->strm->avail_in == 0 &&
+               len == left ? 1 : 0;
+        _tr_stored_block(s, (charf *)s->window + s->block_start, len, last);
+        s->block_start += len;
+        flush_pending(s->strm);
     }
+
+    /* We've done all we can with the available input and output. */
+    return last ? finish_started : need_more;
+}
+
+/* ===========================================================================
+ * Return true if the len bytes at buf look like random data, judging by the
+ * number of pairs of equal bytes among them.  For random bytes that number
+ * is about len * (len - 1) / 512; text, code, tables, and most anything
+ * else worth compressing have several times as many.  Fewer than RAW_MIN
+ * bytes are too few to tell, and are taken to be random.
+ */
+#define RAW_SAMPLE 512  /* most bytes sampled ahead of each RAW_STEP */
+#define RAW_STEP 4096   /* bytes stored for each sample */
+#define RAW_MIN 64      /* smallest useful sample */
+
+local int incompressible(buf, len)
+    const Bytef *buf;
+    unsigned len;
+{
+    ush count[256];
+    ulg pairs = 0;
+    unsigned n;
+
+    if (len < RAW_MIN)
+        return 1;
+    zmemzero((Bytef *)count, sizeof(count));
+    for (n = 0; n < len; n++)
+        pairs += count[buf[n]]++;
+    return pairs * 1024 <= 3 * (ulg)len * (len - 1);
+}
+
+/* ===========================================================================
+ * Leave deflate_raw() for the compression function, and return need_more for
+ * deflate() to call it.  The hash table is brought up to date with the
+ * window, and the match state is reset.  The hash of the lookahead, if any,
+ * is started as fill_window() would.
+ */
+local block_state raw_end(s)
+    deflate_state *s;
+{
+    fix_hash(s);
+    s->raw = 0;
     s->insert = 0;
-    if (flush == Z_FINISH) {
-        FLUSH_BLOCK(s, 1);
-        return finish_done;
+    s->match_length = s->prev_length = MIN_MATCH-1;
+    if (s->lookahead >= MIN_MATCH) {
+        s->ins_h = s->window[s->strstart];
+        UPDATE_HASH(s, s->ins_h, s->window[s->strstart+1]);
+#if MIN_MATCH != 3
+        Call UPDATE_HASH() MIN_MATCH-3 more times
+#endif
     }
-    if ((long)s->strstart > s->block_start)
-        FLUSH_BLOCK(s, 0);
-    return block_done;
+    return need_more;
 }
 
 /* ===========================================================================
- * Compress as much as possible from the input stream, return the current
- * block state.
- * This function does not perform lazy evaluation of matches and inserts
- * new strings in the dictionary only for unmatched strings or for short
- * matches. It is used only for the fast compression options.
+ * Store the input that follows a block that did not compress, as long as
+ * samples of it look random, return the current block state.  This skips
+ * the hashing and the match searches.  The lookahead that the compression
+ * function left in the window is gone through first.  Then the input is
+ * sampled in next_in, and the part that looks random is handed to
+ * deflate_stored(), which copies it straight to next_out if there is room.
+ * When a sample looks compressible, the data before it is sent, the match
+ * state is reset, and deflate() hands the input back to the compression
+ * function.  The strings skipped are not inserted in the dictionary, so
+ * matches into this data will not be found.
  */
-local block_state deflate_fast(s, flush)
+#define FLUSH_RAW(s, last) { \
+   _tr_stored_block(s, (charf *)&s->window[(unsigned)s->block_start], \
+                    (ulg)((long)s->strstart - s->block_start), (last)); \
+   s->block_start = s->strstart; \
+   flush_pending(s->strm); \
+   Tracev((stderr,"[RAW]")); \
+   if (s->strm->avail_out == 0) return (last) ? finish_started : need_more; \
+}
+
+local block_state deflate_raw(s, flush)
     deflate_state *s;
     int flush;
 {
-    IPos hash_head;       /* head of the hash chain */
-    int bflush;           /* set if current block must be flushed */
+    ulg max_block_size = MAX_STORED;
+    ulg max_start, scan;
+    unsigned avail, n, left;
+    block_state bstate;
 
-    for (;;) {
-        /* Make sure that we always have enough lookahead, except
-         * at the end of the input file. We need MAX_MATCH bytes
-         * for the next match, plus MIN_MATCH bytes to insert the
-         * string following the next match.
-         */
-        if (s->lookahead < MIN_LOOKAHEAD) {
-            fill_window(s);
-            if (s->lookahead < MIN_LOOKAHEAD && flush == Z_NO_FLUSH) {
-                return need_more;
-            }
-            if (s->lookahead == 0) break; /* flush the current block */
-        }
+    if (max_block_size > s->pending_buf_size - 5) {
+        max_block_size = s->pending_buf_size - 5;
+    }
+
+    /* Symbols already tallied for the next block belong to the compression
+     * function that went on after the stored block.  Otherwise the data from
+     * block_start on, including a literal deflate_slow() may be holding, is
+     * stored here.  A chunk that deflate_optimal() did not send is stored
+     * without a sample, since its strings are in the dictionary already.
+     */
+    if (s->last_lit) {
+        s->raw = 0;
+        return need_more;
+    }
+    s->match_available = 0;
+    if (s->opt != Z_NULL && s->opt->chunk) {
+        s->strstart += s->opt->chunk;
+        s->lookahead -= s->opt->chunk;
+        s->opt->chunk = 0;
+    }
+
+    /* Go through the lookahead, storing it from the window. */
+    while (s->lookahead) {
+        Assert(s->block_start >= 0L, "block gone");
+        n = MIN(s->lookahead, RAW_SAMPLE);
+        if (!incompressible(s->window + s->strstart, n)) {
+            if ((long)s->strstart > s->block_start)
+                FLUSH_RAW(s, 0);
+            return raw_end(s);
+        }
+        n = MIN(s->lookahead, RAW_STEP);
+        s->strstart += n;
+        s->lookahead -= n;
+
+        /* Emit a stored block if pending_buf will be full: */
+        max_start = s->block_start + max_block_size;
+        if ((ulg)s->strstart >= max_start) {
+            s->lookahead += (uInt)(s->strstart - max_start);
+            s->strstart = (uInt)max_start;
+            FLUSH_RAW(s, 0);
+        }
+    }
+
+    /* Sample the input, as far as this call could take it to the output and
+     * the window, and store the part that looks random.  If a sample looks
+     * compressible, make sure that everything before it is sent.
+     */
+    avail = s->strm->avail_in;
+    scan = (ulg)s->strm->avail_out + s->window_size;
+    if (scan > avail)
+        scan = avail;
+    n = 0;
+    while (n < scan &&
+           incompressible(s->strm->next_in + n, MIN(avail - n, RAW_SAMPLE)))
+        n += MIN(avail - n, RAW_STEP);
+    s->strm->avail_in = n;
+    bstate = deflate_stored(s, n < scan ? Z_BLOCK :
+                               n < avail ? Z_NO_FLUSH : flush);
+    left = s->strm->avail_in;
+    s->strm->avail_in += avail - n;
+    if (n >= scan)
+        return bstate;
+    if (left || (long)s->strstart != s->block_start)
+        return need_more;               /* out of output space */
+    return raw_end(s);
+}
+
+/* ===========================================================================
+ * Compress as much as possible from the input stream, return the current
+ * block state.
+ * This function does not perform lazy evaluation of matches and inserts
+ * new strings in the dictionary only for unmatched strings or for short
+ * matches. It is used only for the fast compression options.
+ */
+local block_state deflate_fast(s, flush)
+    deflate_state *s;
+    int flush;
+{
+    IPos hash_head;       /* head of the hash chain */
+    int bflush;           /* set if current block must be flushed */
+
+    for (;;) {
+        /* Make sure that we always have enough lookahead, except
+         * at the end of the input file. We need MAX_MATCH bytes
+         * for the next match, plus MIN_MATCH bytes to insert the
+         * string following the next match.
+         */
+        if (s->lookahead < MIN_LOOKAHEAD) {
+            fill_window(s);
+            if (s->lookahead < MIN_LOOKAHEAD && flush == Z_NO_FLUSH) {
+                return need_more;
+            }
+            if (s->lookahead == 0) break; /* flush the current block */
+        }
 
         /* Insert the string window[strstart .. strstart+2] in the
          * dictionary, and set hash_head to the head of the hash chain:
          */
         hash_head = NIL;
-        if (s->lookahead >= MIN_MATCH) {
+        if (s->lookahead >= MIN_MATCH + s->hash_four) {
             INSERT_STRING(s, s->strstart, hash_head);
         }
 
@@ -1662,7 +2420,7 @@ local block_state deflate_fast(s, flush)
              * of window index 0 (in particular we have to avoid a match
              * of the string with itself at the start of the input file).
              */
-            s->match_length = longest_match (s, hash_head);
+            s->match_length = z_kernels.longest_match(s, hash_head);
             /* longest_match() sets match_start */
         }
         if (s->match_length >= MIN_MATCH) {
@@ -1677,17 +2435,15 @@ local block_state deflate_fast(s, flush)
              * is not too large. This saves time but degrades compression.
              */
 #ifndef FASTEST
-            if (s->match_length <= s->max_insert_length &&
-                s->lookahead >= MIN_MATCH) {
-                s->match_length--; /* string at strstart already in table */
-                do {
-                    s->strstart++;
-                    INSERT_STRING(s, s->strstart, hash_head);
-                    /* strstart never exceeds WSIZE-MAX_MATCH, so there are
-                     * always MIN_MATCH bytes ahead.
-                     */
-                } while (--s->match_length != 0);
-                s->strstart++;
+            if (s->match_length <= MAX_INSERT(s, s->max_insert_length) &&
+                s->lookahead >= MIN_MATCH + s->hash_four) {
+                /* The string at strstart is already in the table.  strstart
+                 * never exceeds WSIZE-MAX_MATCH, so there are always
+                 * MIN_MATCH bytes ahead.
+                 */
+                insert_run(s, s->strstart + 1, s->match_length - 1);
+                s->strstart += s->match_length;
+                s->match_length = 0;
             } else
 #endif
             {
@@ -1711,7 +2467,7 @@ local block_state deflate_fast(s, flush)
         }
         if (bflush) FLUSH_BLOCK(s, 0);
     }
-    s->insert = s->strstart < MIN_MATCH-1 ? s->strstart : MIN_MATCH-1;
+    s->insert = MIN(s->strstart, MIN_MATCH-1 + s->hash_four);
     if (flush == Z_FINISH) {
         FLUSH_BLOCK(s, 1);
         return finish_done;
@@ -1733,6 +2489,7 @@ local block_state deflate_slow(s, flush)
 {
     IPos hash_head;          /* head of hash chain */
     int bflush;              /* set if current block must be flushed */
+    uInt n;                  /* strings to insert after a match */
 
     /* Process the input block. */
     for (;;) {
@@ -1753,7 +2510,7 @@ local block_state deflate_slow(s, flush)
          * dictionary, and set hash_head to the head of the hash chain:
          */
         hash_head = NIL;
-        if (s->lookahead >= MIN_MATCH) {
+        if (s->lookahead >= MIN_MATCH + s->hash_four) {
             INSERT_STRING(s, s->strstart, hash_head);
         }
 
@@ -1768,7 +2525,7 @@ local block_state deflate_slow(s, flush)
              * of window index 0 (in particular we have to avoid a match
              * of the string with itself at the start of the input file).
              */
-            s->match_length = longest_match (s, hash_head);
+            s->match_length = z_kernels.longest_match(s, hash_head);
             /* longest_match() sets match_start */
 
             if (s->match_length <= 5 && (s->strategy == Z_FILTERED
@@ -1788,7 +2545,8 @@ local block_state deflate_slow(s, flush)
          * match is not better, output the previous match:
          */
         if (s->prev_length >= MIN_MATCH && s->match_length <= s->prev_length) {
-            uInt max_insert = s->strstart + s->lookahead - MIN_MATCH;
+            uInt max_insert = s->strstart + s->lookahead -
+                              (MIN_MATCH + s->hash_four);
             /* Do not insert strings in hash table beyond this. */
 
             check_match(s, s->strstart-1, s->prev_match, s->prev_length);
@@ -1796,21 +2554,31 @@ local block_state deflate_slow(s, flush)
             _tr_tally_dist(s, s->strstart -1 - s->prev_match,
                            s->prev_length - MIN_MATCH, bflush);
 
-            /* Insert in hash table all strings up to the end of the match.
-             * strstart-1 and strstart are already inserted. If there is not
-             * enough lookahead, the last two strings are not inserted in
-             * the hash table.
+            /* Insert in hash table all strings up to the end of the match,
+             * unless it is longer than insert_limit.  strstart-1 and strstart
+             * are already inserted. If there is not enough lookahead, the
+             * last strings are not inserted in the hash table.
              */
             s->lookahead -= s->prev_length-1;
-            s->prev_length -= 2;
-            do {
-                if (++s->strstart <= max_insert) {
-                    INSERT_STRING(s, s->strstart, hash_head);
-                }
-            } while (--s->prev_length != 0);
+            if (s->prev_length <= MAX_INSERT(s, MAX_MATCH)) {
+                n = s->prev_length - 2;
+                if (s->strstart + n > max_insert)
+                    n = max_insert > s->strstart ? max_insert - s->strstart : 0;
+                if (n)
+                    insert_run(s, s->strstart + 1, n);
+                s->strstart += s->prev_length - 1;
+            }
+            else {
+                s->strstart += s->prev_length - 1;
+                s->ins_h = s->window[s->strstart];
+                UPDATE_HASH(s, s->ins_h, s->window[s->strstart+1]);
+#if MIN_MATCH != 3
+                Call UPDATE_HASH() MIN_MATCH-3 more times
+#endif
+            }
+            s->prev_length = MIN_MATCH-1;
             s->match_available = 0;
             s->match_length = MIN_MATCH-1;
-            s->strstart++;
 
             if (bflush) FLUSH_BLOCK(s, 0);
 
@@ -1826,7 +2594,7 @@ local block_state deflate_slow(s, flush)
             }
             s->strstart++;
             s->lookahead--;
-            if (s->strm->avail_out == 0) return need_more;
+            if (s->strm->avail_out == 0 || s->raw) return need_more;
         } else {
             /* There is no previous match to compare with, wait for
              * the next step to decide.
@@ -1842,7 +2610,512 @@ local block_state deflate_slow(s, flush)
         _tr_tally_lit(s, s->window[s->strstart-1], bflush);
         s->match_available = 0;
     }
-    s->insert = s->strstart < MIN_MATCH-1 ? s->strstart : MIN_MATCH-1;
+    s->insert = MIN(s->strstart, MIN_MATCH-1 + s->hash_four);
+    if (flush == Z_FINISH) {
+        FLUSH_BLOCK(s, 1);
+        return finish_done;
+    }
+    if (s->last_lit)
+        FLUSH_BLOCK(s, 0);
+    return block_done;
+}
+
+/* ===========================================================================
+ * Search the hash chain at hash_head for a match at strstart for
+ * deflate_medium().  Return its length, with match_start set, or MIN_MATCH-1
+ * if there is no match worth sending.
+ */
+local uInt medium_match(s, hash_head)
+    deflate_state *s;
+    IPos hash_head;
+{
+    uInt len = MIN_MATCH-1;
+
+    if (hash_head != NIL && s->strstart - hash_head <= MAX_DIST(s)) {
+        len = z_kernels.longest_match(s, hash_head);
+        /* longest_match() sets match_start */
+
+        if (len <= 5 && (s->strategy == Z_FILTERED
+#if TOO_FAR <= 32767
+            || (len == MIN_MATCH &&
+                s->strstart - s->match_start > TOO_FAR)
+#endif
+            )) {
+            len = MIN_MATCH-1;
+        }
+    }
+    return len;
+}
+
+/* ===========================================================================
+ * Between deflate_fast() and deflate_slow() in speed and compression.  A match
+ * is taken at once as in deflate_fast(), but if it is shorter than
+ * max_lazy_match, the match where it ends is looked for too.  If that match
+ * extends back over all but at most one byte of the current one, it is used
+ * in place of the current one, which saves a length and distance where the
+ * lazy evaluation of deflate_slow() would have found the later match.  The
+ * match found where the current one ends is kept for the next step, so each
+ * string is still searched for only once.
+ */
+local block_state deflate_medium(s, flush)
+    deflate_state *s;
+    int flush;
+{
+    IPos hash_head;       /* head of the hash chain */
+    int bflush;           /* set if current block must be flushed */
+    uInt length;          /* match length at strstart, 1 for a literal */
+    IPos start;           /* start of that match */
+    uInt next_length = 0; /* length of the match where it ends, or 0 */
+    IPos next_start = 0;  /* start of that match */
+    uInt back;            /* how far the next match extends back */
+    uInt n;               /* strings to insert after a match */
+    uInt max_insert;      /* do not insert strings in hash table beyond this */
+
+    s->prev_length = MIN_MATCH-1;
+    for (;;) {
+        /* Make sure that we always have enough lookahead, except
+         * at the end of the input file. We need MAX_MATCH bytes
+         * for the next match, plus MIN_MATCH bytes to insert the
+         * string following the next match.
+         */
+        if (s->lookahead < MIN_LOOKAHEAD) {
+            fill_window(s);
+            if (s->lookahead < MIN_LOOKAHEAD && flush == Z_NO_FLUSH) {
+                return need_more;
+            }
+            if (s->lookahead == 0) break; /* flush the current block */
+            next_length = 0;
+        }
+
+        /* Insert the string window[strstart .. strstart+2] in the
+         * dictionary, and set hash_head to the head of the hash chain:
+         */
+        hash_head = NIL;
+        if (s->lookahead >= MIN_MATCH + s->hash_four) {
+            INSERT_STRING(s, s->strstart, hash_head);
+        }
+
+        /* Use the match found at strstart by the previous step, if any */
+        if (next_length) {
+            length = next_length;
+            start = next_start;
+            next_length = 0;
+        }
+        else {
+            length = medium_match(s, hash_head);
+            start = s->match_start;
+        }
+        if (length < MIN_MATCH)
+            length = 1;
+
+        /* Look for a match where this one ends, without inserting that string
+         * yet.  If it extends back over this one, move the boundary.
+         */
+        if (length >= MIN_MATCH && length < s->max_lazy_match &&
+            s->lookahead - length >= MIN_LOOKAHEAD) {
+            s->strstart += length;
+            s->lookahead -= length;
+            next_length = medium_match(s,
+                                       s->head[HASH_FRESH(s, s->strstart)]);
+            next_start = s->match_start;
+            s->strstart -= length;
+            s->lookahead += length;
+            if (next_length >= MIN_MATCH) {
+                back = 0;
+                while (back < length && next_length + back < MAX_MATCH &&
+                       back < next_start &&
+                       s->window[s->strstart + length - 1 - back] ==
+                       s->window[next_start - 1 - back])
+                    back++;
+                if (back == length) {
+                    /* the next match covers this one: send it instead */
+                    start = next_start - back;
+                    length += next_length;
+                    next_length = 0;
+                }
+                else if (back == length - 1) {
+                    /* send a literal, and then the longer next match */
+                    next_start -= back;
+                    next_length += back;
+                    length = 1;
+                }
+            }
+        }
+
+        if (length >= MIN_MATCH) {
+            check_match(s, s->strstart, start, length);
+
+            _tr_tally_dist(s, s->strstart - start, length - MIN_MATCH, bflush);
+
+            s->lookahead -= length;
+
+            /* Insert all of the strings in the match, as deflate_slow() does,
+             * unless it is longer than insert_limit.  The string at strstart
+             * is already in the table.  If a flush or the end of the input
+             * left too little lookahead, the last strings are not inserted.
+             */
+            if (length <= MAX_INSERT(s, MAX_MATCH)) {
+                max_insert = s->strstart + length + s->lookahead -
+                             (MIN_MATCH + s->hash_four);
+                n = length - 1;
+                if (s->strstart + n > max_insert)
+                    n = max_insert > s->strstart ? max_insert - s->strstart : 0;
+                if (n)
+                    insert_run(s, s->strstart + 1, n);
+                s->strstart += length;
+            }
+            else {
+                s->strstart += length;
+                s->ins_h = s->window[s->strstart];
+                UPDATE_HASH(s, s->ins_h, s->window[s->strstart+1]);
+#if MIN_MATCH != 3
+                Call UPDATE_HASH() MIN_MATCH-3 more times
+#endif
+            }
+        } else {
+            /* No match, output a literal byte */
+            Tracevv((stderr,"%c", s->window[s->strstart]));
+            _tr_tally_lit (s, s->window[s->strstart], bflush);
+            s->lookahead--;
+            s->strstart++;
+        }
+        if (bflush) FLUSH_BLOCK(s, 0);
+    }
+    s->insert = MIN(s->strstart, MIN_MATCH-1 + s->hash_four);
+    if (flush == Z_FINISH) {
+        FLUSH_BLOCK(s, 1);
+        return finish_done;
+    }
+    if (s->last_lit)
+        FLUSH_BLOCK(s, 0);
+    return block_done;
+}
+
+/* ===========================================================================
+ * Find the matches at strstart+i for deflate_optimal(), following the hash
+ * chain from cur_match.  Each match found is longer than the ones before it,
+ * so o->len[i][] is increasing, and each is the closest one of its length.  If
+ * there are more than OPT_MATCHES, the last one is replaced, which keeps the
+ * longest.  Return the length of the longest match, or MIN_MATCH-1 if there
+ * is none.
+ */
+local uInt opt_find(s, i, cur_match, max_len)
+    deflate_state *s;
+    unsigned i;             /* position in the chunk */
+    IPos cur_match;         /* head of the hash chain */
+    unsigned max_len;       /* longest match allowed */
+{
+    struct opt_s FAR *o = s->opt;
+    IPos pos = s->strstart + i;
+    Bytef *scan = s->window + pos;
+    Bytef *match;
+    IPos limit = pos > (IPos)MAX_DIST(s) ? pos - (IPos)MAX_DIST(s) : NIL;
+    unsigned chain_length = s->max_chain_length;
+    unsigned nice_match = (unsigned)s->nice_match < max_len ?
+                          (unsigned)s->nice_match : max_len;
+    unsigned best = MIN_MATCH-1, len, k = 0;
+
+    do {
+        Assert(cur_match < pos, "no future");
+        match = s->window + cur_match;
+        if (match[best] != scan[best] || match[0] != scan[0] ||
+            match[1] != scan[1]) continue;
+        len = 2;
+        while (len < max_len && match[len] == scan[len])
+            len++;
+        if (len > best) {
+            if (k == OPT_MATCHES)
+                k--;
+            o->len[i][k] = (ush)len;
+            o->dist[i][k] = (ush)(pos - cur_match);
+            k++;
+            best = len;
+            if (len >= nice_match) break;
+        }
+    } while ((cur_match = s->prev[cur_match & s->w_mask]) > limit
+             && --chain_length != 0);
+    o->count[i] = (uch)k;
+    return best;
+}
+
+/* ===========================================================================
+ * Insert the strings of the next n bytes in the dictionary and find their
+ * matches.  As in deflate_slow(), there is no search at the strings inside a
+ * match of nice_match bytes or more.
+ */
+local void opt_matches(s, n)
+    deflate_state *s;
+    unsigned n;             /* bytes in the chunk */
+{
+    struct opt_s FAR *o = s->opt;
+    IPos hash_head;
+    unsigned i, max_len, skip = 0;
+    uInt best;
+
+    for (i = 0; i < n; i++) {
+        o->count[i] = 0;
+        hash_head = NIL;
+        if (s->lookahead - i >= MIN_MATCH + s->hash_four) {
+            INSERT_STRING(s, s->strstart + i, hash_head);
+        }
+        if (skip) {
+            skip--;
+            continue;
+        }
+        max_len = n - i < MAX_MATCH ? n - i : MAX_MATCH;
+        if (hash_head != NIL && max_len >= MIN_MATCH &&
+            s->strstart + i - hash_head <= MAX_DIST(s)) {
+            best = opt_find(s, i, hash_head, max_len);
+            if (best >= (uInt)s->nice_match)
+                skip = best - 1;
+        }
+    }
+}
+
+/* ===========================================================================
+ * Set the parse of the chunk to the longest match at each step, to get the
+ * first counts to price the symbols with.
+ */
+local void opt_greedy(s, n)
+    deflate_state *s;
+    unsigned n;
+{
+    struct opt_s FAR *o = s->opt;
+    unsigned i, k;
+
+    for (i = 0; i < n; i++) {
+        k = o->count[i];
+        if (k) {
+            o->choice[i] = o->len[i][k - 1];
+            o->choice_dist[i] = o->dist[i][k - 1];
+        }
+        else
+            o->choice[i] = 1;
+    }
+}
+
+/* ===========================================================================
+ * Find the parse of the chunk with the fewest bits for the costs in o->lcost
+ * and o->dcost, going back from the end: cost[i] is the least number of bits
+ * for the bytes from i to n, taking at i either a literal or a match of any
+ * length up to that of one of the matches found there.
+ */
+local void opt_parse(s, n)
+    deflate_state *s;
+    unsigned n;
+{
+    struct opt_s FAR *o = s->opt;
+    Bytef *window = s->window + s->strstart;
+    uch len_cost[MAX_MATCH+1];
+    unsigned i, j, len, prev, dist;
+    ulg best, cost, dcost;
+
+    for (len = MIN_MATCH; len <= MAX_MATCH; len++)
+        len_cost[len] = o->lcost[_length_code[len - MIN_MATCH] + LITERALS+1];
+
+    o->cost[n] = 0;
+    i = n;
+    while (i--) {
+        best = o->cost[i + 1] + o->lcost[window[i]];
+        o->choice[i] = 1;
+        prev = MIN_MATCH-1;
+        for (j = 0; j < o->count[i]; j++) {
+            dist = o->dist[i][j];
+            dcost = o->dcost[d_code(dist - 1)];
+            for (len = prev + 1; len <= o->len[i][j]; len++) {
+                cost = o->cost[i + len] + len_cost[len] + dcost;
+                if (cost < best) {
+                    best = cost;
+                    o->choice[i] = (ush)len;
+                    o->choice_dist[i] = (ush)dist;
+                }
+            }
+            prev = o->len[i][j];
+        }
+        o->cost[i] = best;
+    }
+}
+
+/* ===========================================================================
+ * Count the symbols of the parse of the chunk in o->lfreq and o->dfreq, and
+ * return how many there are.
+ */
+local unsigned opt_count(s, n)
+    deflate_state *s;
+    unsigned n;
+{
+    struct opt_s FAR *o = s->opt;
+    unsigned i, syms = 0;
+
+    zmemzero(o->lfreq, sizeof(o->lfreq));
+    zmemzero(o->dfreq, sizeof(o->dfreq));
+    for (i = 0; i < n; i += o->choice[i]) {
+        if (o->choice[i] == 1)
+            o->lfreq[s->window[s->strstart + i]]++;
+        else {
+            o->lfreq[_length_code[o->choice[i] - MIN_MATCH] + LITERALS+1]++;
+            o->dfreq[d_code(o->choice_dist[i] - 1)]++;
+        }
+        syms++;
+    }
+    return syms;
+}
+
+/* ===========================================================================
+ * Return the bits for a block with the symbols of the current block if block
+ * is true, and those of the chunk if chunk is true.  If costs is true, also
+ * price each symbol for opt_parse() with the trees of that block.
+ */
+local ulg opt_price(s, block, chunk, costs)
+    deflate_state *s;
+    int block;
+    int chunk;
+    int costs;
+{
+    struct opt_s FAR *o = s->opt;
+    unsigned lfreq[L_CODES], dfreq[D_CODES];
+    int n;
+
+    for (n = 0; n < L_CODES; n++)
+        lfreq[n] = (block ? s->dyn_ltree[n].Freq : 0) +
+                   (chunk ? o->lfreq[n] : 0);
+    for (n = 0; n < D_CODES; n++)
+        dfreq[n] = (block ? s->dyn_dtree[n].Freq : 0) +
+                   (chunk ? o->dfreq[n] : 0);
+    return _tr_cost(s, lfreq, dfreq, costs ? o->lcost : Z_NULL,
+                    costs ? o->dcost : Z_NULL);
+}
+
+/* ===========================================================================
+ * Find a new parse of the chunk up to passes times, each time with the costs
+ * of the symbols of the parse before, and with those of the current block if
+ * block is true.  Stop, going back to the parse before, when one does not take
+ * fewer bits than it.  The symbols of the parse are left counted, and their
+ * number is returned.
+ */
+local unsigned opt_refine(s, n, block, passes)
+    deflate_state *s;
+    unsigned n;
+    int block;
+    uInt passes;
+{
+    struct opt_s FAR *o = s->opt;
+    unsigned syms;
+    ulg bits, next;
+
+    syms = opt_count(s, n);
+    bits = opt_price(s, block, 1, 0);
+    while (passes--) {
+        zmemcpy(o->prev_choice, o->choice, n * sizeof(ush));
+        zmemcpy(o->prev_dist, o->choice_dist, n * sizeof(ush));
+        opt_price(s, block, 1, 1);
+        opt_parse(s, n);
+        syms = opt_count(s, n);
+        next = opt_price(s, block, 1, 0);
+        if (next >= bits) {
+            zmemcpy(o->choice, o->prev_choice, n * sizeof(ush));
+            zmemcpy(o->choice_dist, o->prev_dist, n * sizeof(ush));
+            syms = opt_count(s, n);
+            break;
+        }
+        bits = next;
+    }
+    return syms;
+}
+
+/* ===========================================================================
+ * Optimal parsing for levels 10 to 12.  The input is taken a chunk of up to
+ * OPT_CHUNK bytes at a time.  All of the matches at each position of the
+ * chunk are found first, then the parse with the fewest bits is found for
+ * the costs of the symbols with the Huffman trees that the block would have,
+ * starting with the symbols of the greedy parse, and this is repeated up to
+ * good_match times with the symbols of the previous parse, for as long as it
+ * saves bits.  The chunk then
+ * starts a new block if the current block and the chunk take fewer bits
+ * apart than together, as computed with the same trees that
+ * _tr_flush_block() will build.  The result is standard deflate data.
+ */
+local block_state deflate_optimal(s, flush)
+    deflate_state *s;
+    int flush;
+{
+    struct opt_s FAR *o = s->opt;
+    int bflush = 0;             /* set if current block must be flushed */
+    unsigned n;                 /* bytes in the chunk */
+    unsigned i, syms;
+    ush length, distance;
+
+    Assert(o != Z_NULL, "no optimal parsing memory");
+    for (;;) {
+        /* Send the chunk parsed by the last call, if it could not be then */
+        n = o->chunk;
+        o->chunk = 0;
+        if (n == 0) {
+            /* Fill the window for a whole chunk unless it is full, and wait
+             * for one unless flushing.
+             */
+            if (s->lookahead < MIN_LOOKAHEAD ||
+                (s->lookahead < OPT_CHUNK + MIN_LOOKAHEAD &&
+                 s->strstart + s->lookahead + 1 < s->window_size)) {
+                fill_window(s);
+            }
+            if (s->lookahead < OPT_CHUNK + MIN_LOOKAHEAD &&
+                s->strm->avail_in == 0 && flush == Z_NO_FLUSH) {
+                return need_more;
+            }
+            if (s->lookahead == 0) break; /* flush the current block */
+
+            /* Leave the last bytes of a string for later unless this is the
+             * end of the input, so that every string of the chunk can be
+             * inserted.
+             */
+            n = s->lookahead;
+            if (flush == Z_NO_FLUSH || s->strm->avail_in != 0)
+                n -= MIN_MATCH-1 + s->hash_four;
+            if (n > OPT_CHUNK) n = OPT_CHUNK;
+            if (n > s->lit_bufsize - 1) n = s->lit_bufsize - 1;
+
+            opt_matches(s, n);
+            opt_greedy(s, n);
+            syms = opt_refine(s, n, 1, s->good_match);
+
+            /* Start a new block if the symbols would not fit, or if that
+             * takes fewer bits, and then price the chunk for its own trees.
+             * The strings of the chunk are in the dictionary now, so if the
+             * new block did not all fit in the output, the chunk is kept for
+             * the next call.  If it was stored, deflate_raw() takes the chunk
+             * instead.
+             */
+            if (s->last_lit &&
+                (s->last_lit + syms > s->lit_bufsize - 1 ||
+                 opt_price(s, 1, 0, 0) + opt_price(s, 0, 1, 0) <
+                 opt_price(s, 1, 1, 0))) {
+                FLUSH_BLOCK_ONLY(s, 0);
+                opt_refine(s, n, 0, s->good_match);
+                if (s->strm->avail_out == 0 || s->raw) {
+                    o->chunk = n;
+                    return need_more;
+                }
+            }
+        }
+
+        for (i = 0; i < n; i += length) {
+            length = o->choice[i];
+            if (length == 1) {
+                Tracevv((stderr,"%c", s->window[s->strstart]));
+                _tr_tally_lit(s, s->window[s->strstart], bflush);
+            }
+            else {
+                distance = o->choice_dist[i];
+                check_match(s, s->strstart, s->strstart - distance, length);
+                _tr_tally_dist(s, distance, length - MIN_MATCH, bflush);
+            }
+            s->strstart += length;
+            s->lookahead -= length;
+        }
+        if (bflush) FLUSH_BLOCK(s, 0);
+    }
+    s->insert = MIN(s->strstart, MIN_MATCH-1 + s->hash_four);
     if (flush == Z_FINISH) {
         FLUSH_BLOCK(s, 1);
         return finish_done;
@@ -1930,38 +3203,194 @@ local block_state deflate_rle(s, flush)
 /* ===========================================================================
  * For Z_HUFFMAN_ONLY, do not look for matches.  Do not maintain a hash table.
  * (It will be regenerated if this run of deflate switches away from Huffman.)
+ *
+ * The literals of a block are tallied all at once by _tr_tally_lits(), and
+ * _tr_flush_block() sends them from the input bytes, without going through
+ * d_buf.  While no input is held, whole blocks are compressed straight from
+ * next_in, and the window is then updated as deflate_stored() does.  Less
+ * than a block of input is gathered in l_buf, with last_lit counting it,
+ * until there is a whole block or deflate() is flushing.
  */
 local block_state deflate_huff(s, flush)
     deflate_state *s;
     int flush;
 {
-    int bflush;             /* set if current block must be flushed */
+    uInt max_block = s->lit_bufsize - 1;    /* largest block */
+    unsigned used, have, n;
+    uInt len;
+    int last = 0;
+    charf *buf;
 
+    s->match_length = 0;
     for (;;) {
-        /* Make sure that we have a literal to write. */
-        if (s->lookahead == 0) {
-            fill_window(s);
-            if (s->lookahead == 0) {
-                if (flush == Z_NO_FLUSH)
-                    return need_more;
-                break;      /* flush the current block */
+        /* Compress whole blocks from next_in, and skip the input covered. */
+        if (s->last_lit == 0 && s->lookahead == 0) {
+            used = s->strm->avail_in;
+            while (s->strm->avail_in >= max_block ||
+                   (s->strm->avail_in && flush != Z_NO_FLUSH)) {
+                buf = (charf *)s->strm->next_in;
+                len = _tr_tally_lits(s, (const Bytef *)buf,
+                                     MIN(s->strm->avail_in, max_block));
+                last = flush == Z_FINISH && len == s->strm->avail_in;
+                read_buf(s->strm, Z_NULL, len);
+                _tr_flush_block(s, buf, (ulg)len, last);
+                flush_pending(s->strm);
+                Tracev((stderr,"[FLUSH]"));
+                if (last || s->strm->avail_out == 0 || s->raw)
+                    break;
             }
+            used -= s->strm->avail_in;  /* number of input bytes skipped */
+            if (used)
+                keep_window(s, s->strm->next_in - used, used);
+            if (last)
+                return s->strm->avail_out == 0 ? finish_started : finish_done;
+            if (s->strm->avail_out == 0 || s->raw)
+                return need_more;
         }
 
-        /* Output a literal byte */
-        s->match_length = 0;
-        Tracevv((stderr,"%c", s->window[s->strstart]));
-        _tr_tally_lit (s, s->window[s->strstart], bflush);
-        s->lookahead--;
-        s->strstart++;
-        if (bflush) FLUSH_BLOCK(s, 0);
+        /* Gather input in l_buf: first any lookahead that another compression
+         * function left in the window, then next_in, which is also kept in the
+         * window.
+         */
+        have = max_block - s->last_lit;
+        if (s->lookahead) {
+            have = MIN(have, s->lookahead);
+            zmemcpy(s->l_buf + s->last_lit, s->window + s->strstart, have);
+            s->strstart += have;
+            s->block_start = s->strstart;
+            s->lookahead -= have;
+            s->insert += MIN(have, s->w_size - s->insert);
+        }
+        else {
+            have = read_buf(s->strm, s->l_buf + s->last_lit, have);
+            if (have)
+                keep_window(s, s->l_buf + s->last_lit, have);
+        }
+        s->last_lit += have;
+        if (s->last_lit < max_block) {
+            if (s->lookahead || s->strm->avail_in)
+                continue;
+            if (flush == Z_NO_FLUSH)
+                return need_more;
+            if (s->last_lit == 0)
+                break;
+        }
+
+        /* Tally and send a block of what was gathered, and move what is left
+         * of it, if the block ended early, to the start of l_buf.
+         */
+        have = s->last_lit;
+        len = _tr_tally_lits(s, s->l_buf, have);
+        last = flush == Z_FINISH && len == have && s->lookahead == 0 &&
+               s->strm->avail_in == 0;
+        _tr_flush_block(s, (charf *)s->l_buf, (ulg)len, last);
+        for (n = 0; len + n < have; n++)
+            s->l_buf[n] = s->l_buf[len + n];
+        s->last_lit = n;
+        flush_pending(s->strm);
+        Tracev((stderr,"[FLUSH]"));
+        if (last)
+            return s->strm->avail_out == 0 ? finish_started : finish_done;
+        if (s->strm->avail_out == 0 || s->raw)
+            return need_more;
     }
-    s->insert = 0;
     if (flush == Z_FINISH) {
         FLUSH_BLOCK(s, 1);
         return finish_done;
     }
-    if (s->last_lit)
-        FLUSH_BLOCK(s, 0);
     return block_done;
 }
+
+/* ===========================================================================
+ * For Z_QUICK, look for a match only at the most recent string with the same
+ * hash, and take it if there is one.  Only the strings at which a match is
+ * looked for are inserted in the hash chains.  The literals and matches are
+ * sent with the fixed codes as they are found, instead of being tallied for a
+ * block, so one block can span several calls.  s->block_open records whether
+ * a block has been started, and whether it is the last one.  This gives up
+ * some compression for speed, even compared with level 1, and can expand
+ * incompressible data by up to one eighth.
+ */
+local block_state deflate_quick(s, flush)
+    deflate_state *s;
+    int flush;
+{
+    IPos hash_head;         /* head of the hash chain */
+    uInt h;                 /* hash of the current string */
+    int last = flush == Z_FINISH;
+
+    if (last && s->block_open != 2) {
+        if (s->block_open)
+            _tr_quick_end(s, 0);
+        _tr_quick_start(s, 1);
+        s->block_open = 2;
+    }
+    for (;;) {
+        /* Make sure that the bits in the bit buffer, the next symbol, the
+         * start of a block, and the end of the block will fit in the pending
+         * buffer.
+         */
+        if (s->pending + Buf_size/8 + 10 > s->pending_buf_size) {
+            flush_pending(s->strm);
+            if (s->strm->avail_out == 0)
+                return need_more;
+        }
+
+        /* Make sure that we always have enough lookahead, except
+         * at the end of the input file. We need MAX_MATCH bytes
+         * for the next match, plus MIN_MATCH bytes to insert the
+         * string following the next match.
+         */
+        if (s->lookahead < MIN_LOOKAHEAD) {
+            fill_window(s);
+            if (s->lookahead < MIN_LOOKAHEAD && flush == Z_NO_FLUSH) {
+                return need_more;
+            }
+            if (s->lookahead == 0) break; /* end the current block */
+        }
+        if (s->block_open == 0) {
+            _tr_quick_start(s, 0);
+            s->block_open = 1;
+        }
+
+        /* Insert the current string, and check the string that was at the
+         * head of its hash chain.
+         */
+        s->match_length = 0;
+        if (s->lookahead >= MIN_MATCH + s->hash_four) {
+            h = HASH_FRESH(s, s->strstart);
+            hash_head = s->head[h];
+            s->prev[s->strstart & s->w_mask] = (Pos)hash_head;
+            s->head[h] = (Pos)s->strstart;
+            if (hash_head != NIL &&
+                s->strstart - hash_head <= MAX_DIST(s))
+                s->match_length = quick_match(s, hash_head);
+        }
+        if (s->match_length >= MIN_MATCH) {
+            check_match(s, s->strstart, s->match_start, s->match_length);
+
+            _tr_quick_dist(s, s->strstart - s->match_start,
+                           s->match_length - MIN_MATCH);
+
+            s->lookahead -= s->match_length;
+            s->strstart += s->match_length;
+            s->match_length = 0;
+        } else {
+            /* No match, output a literal byte */
+            Tracevv((stderr,"%c", s->window[s->strstart]));
+            _tr_quick_lit(s, s->window[s->strstart]);
+            s->lookahead--;
+            s->strstart++;
+        }
+    }
+    s->insert = 0;
+    if (s->block_open) {
+        _tr_quick_end(s, last);
+        s->block_open = 0;
+    }
+    s->block_start = (long)s->strstart;
+    flush_pending(s->strm);
+    if (s->strm->avail_out == 0)
+        return last ? finish_started : need_more;
+    return last ? finish_done : block_done;
+}
@@ -45,10 +45,23 @@
 #define HEAP_SIZE (2*L_CODES+1)
 /* maximum heap size */
 
+#define SPLIT_TYPES 10
+/* number of kinds of symbols counted to decide where to end a block */
+
 #define MAX_BITS 15
 /* All codes must not exceed MAX_BITS bits */
 
-#define Buf_size 16
+/* The bit buffer is 64 bits where the compiler has a 64-bit integer, so that
+   the bits of a whole match can be sent at once, and the buffer goes to
+   pending_buf eight bytes at a time.  Otherwise it is 16 bits. */
+#if defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1400) || \
+    (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+#  define Buf_size 64
+   typedef unsigned long long bi_word;
+#else
+#  define Buf_size 16
+   typedef ush bi_word;
+#endif
 /* size of bit buffer in bi_buf */
 
 #define INIT_STATE    42
@@ -148,6 +161,8 @@ typedef struct internal_state {
      *   hash_shift * MIN_MATCH >= hash_bits
      */
 
+    uInt  hash_four;      /* set by deflateHash() to hash four bytes */
+
     long block_start;
     /* Window position at the beginning of the current output block. Gets
      * negative when the window is moved backwards.
@@ -179,7 +194,8 @@ typedef struct internal_state {
 #   define max_insert_length  max_lazy_match
     /* Insert new strings in the hash table only if the match length is not
      * greater than this length. This saves time but degrades compression.
-     * max_insert_length is used only for compression levels <= 3.
+     * max_insert_length is used only for compression levels <= 3, unless
+     * insert_limit is set.
      */
 
     int level;    /* compression level (1..9) */
@@ -238,6 +254,15 @@ typedef struct internal_state {
 
     uInt last_lit;      /* running index in l_buf */
 
+    uInt split_lit;
+    /* Value of last_lit at which _tr_split() next looks at the symbols, to end
+     * the block early if they differ from the ones before.  It is never more
+     * than lit_bufsize-1, where the block has to end.
+     */
+
+    uInt split_count[SPLIT_TYPES];
+    /* Number of symbols of each kind in the block before the last split_lit */
+
     ushf *d_buf;
     /* Buffer for distances. To simplify the code, d_buf and l_buf have
      * the same number of elements. To use different lengths, an extra flag
@@ -248,19 +273,33 @@ typedef struct internal_state {
     ulg static_len;     /* bit length of current block with static trees */
     uInt matches;       /* number of string matches in current block */
     uInt insert;        /* bytes at end of window left to insert */
+    int block_open;     /* deflate_quick() block: 0 none, 1 open, 2 last */
+    int raw;            /* true if the input is stored by deflate_raw() */
+    int slides;         /* hash slides left undone, 2: clear the hash */
+
+    uInt insert_limit;
+    /* Set by deflateInsertLimit() in place of max_insert_length, for levels
+     * 1 through 9, or 0 to use max_insert_length at levels <= 3 and insert
+     * all strings above.
+     */
+
+    struct opt_s FAR *opt;
+    /* Matches and costs for deflate_optimal(), allocated only for levels
+     * above 9, else Z_NULL.
+     */
 
 #ifdef DEBUG
     ulg compressed_len; /* total bit length of compressed file mod 2^32 */
     ulg bits_sent;      /* bit length of compressed data sent mod 2^32 */
 #endif
 
-    ush bi_buf;
+    bi_word bi_buf;
     /* Output buffer. bits are inserted starting at the bottom (least
      * significant bits).
      */
     int bi_valid;
-    /* Number of valid bits in bi_buf.  All bits above the last valid bit
-     * are always zero.
+    /* Number of valid bits in bi_buf, less than Buf_size between calls of
+     * send_bits().  All bits above the last valid bit are always zero.
      */
 
     ulg high_water;
@@ -301,6 +340,16 @@ void ZLIB_INTERNAL _tr_flush_bits OF((deflate_state *s));
 void ZLIB_INTERNAL _tr_align OF((deflate_state *s));
 void ZLIB_INTERNAL _tr_stored_block OF((deflate_state *s, charf *buf,
                         ulg stored_len, int last));
+int ZLIB_INTERNAL _tr_split OF((deflate_state *s));
+uInt ZLIB_INTERNAL _tr_tally_lits OF((deflate_state *s, const Bytef *buf,
+                        uInt len));
+void ZLIB_INTERNAL _tr_quick_start OF((deflate_state *s, int last));
+void ZLIB_INTERNAL _tr_quick_lit OF((deflate_state *s, unsigned c));
+void ZLIB_INTERNAL _tr_quick_dist OF((deflate_state *s, unsigned dist,
+                        unsigned lc));
+void ZLIB_INTERNAL _tr_quick_end OF((deflate_state *s, int last));
+ulg ZLIB_INTERNAL _tr_cost OF((deflate_state *s, const unsigned *lfreq,
+                        const unsigned *dfreq, uch *lcost, uch *dcost));
 
 #define d_code(dist) \
    ((dist) < 256 ? _dist_code[dist] : _dist_code[256+((dist)>>7)])
@@ -309,9 +358,6 @@ void ZLIB_INTERNAL _tr_stored_block OF((deflate_state *s, charf *buf,
  * used.
  */
 
-#ifndef DEBUG
-/* Inline versions of _tr_tally for speed: */
-
 #if defined(GEN_TREES_H) || !defined(STDC)
   extern uch ZLIB_INTERNAL _length_code[];
   extern uch ZLIB_INTERNAL _dist_code[];
@@ -320,22 +366,26 @@ void ZLIB_INTERNAL _tr_stored_block OF((deflate_state *s, charf *buf,
   extern const uch ZLIB_INTERNAL _dist_code[];
 #endif
 
+#ifndef DEBUG
+/* Inline versions of _tr_tally for speed: */
+
 # define _tr_tally_lit(s, c, flush) \
   { uch cc = (c); \
     s->d_buf[s->last_lit] = 0; \
     s->l_buf[s->last_lit++] = cc; \
     s->dyn_ltree[cc].Freq++; \
-    flush = (s->last_lit == s->lit_bufsize-1); \
+    flush = (s->last_lit == s->split_lit && _tr_split(s)); \
    }
 # define _tr_tally_dist(s, distance, length, flush) \
   { uch len = (length); \
     ush dist = (distance); \
     s->d_buf[s->last_lit] = dist; \
     s->l_buf[s->last_lit++] = len; \
+    s->matches++; \
     dist--; \
     s->dyn_ltree[_length_code[len]+LITERALS+1].Freq++; \
     s->dyn_dtree[d_code(dist)].Freq++; \
-    flush = (s->last_lit == s->lit_bufsize-1); \
+    flush = (s->last_lit == s->split_lit && _tr_split(s)); \
   }
 #else
 # define _tr_tally_lit(s, c, flush) flush = _tr_tally(s, 0, c)
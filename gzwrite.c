@@ -528,7 +528,10 @@ int ZEXPORT gzsetparams(file, level, strategy)
         /* flush previous input with previous parameters before changing */
         if (strm->avail_in && gz_comp(state, Z_PARTIAL_FLUSH) == -1)
             return state->err;
-        deflateParams(strm, level, strategy);
+        if (deflateParams(strm, level, strategy) == Z_MEM_ERROR) {
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            return state->err;
+        }
     }
     state->level = level;
     state->strategy = strategy;
@@ -17,6 +17,9 @@
 
 /* function prototypes */
 local void fixedtables OF((struct inflate_state FAR *state));
+#ifdef BUILDFIXED
+   local void buildfixed OF((void));
+#endif
 
 /*
    strm provides memory allocation functions in zalloc and zfree, or
@@ -55,6 +58,7 @@ int stream_size;
 #else
     strm->zfree = zcfree;
 #endif
+    Z_KERNELS_INIT();
     state = (struct inflate_state FAR *)ZALLOC(strm, 1,
                                                sizeof(struct inflate_state));
     if (state == Z_NULL) return Z_MEM_ERROR;
@@ -69,50 +73,53 @@ int stream_size;
     return Z_OK;
 }
 
+#ifdef BUILDFIXED
+local code FAR *lenfix, *distfix;
+local code fixed[544];
+local z_once_t fixed_made = Z_ONCE_INIT;
+
+/* Build the fixed tables.  This is only called once, through Z_ONCE(). */
+local void buildfixed()
+{
+    unsigned sym, bits;
+    code FAR *next;
+    unsigned short lens[288];           /* code lengths */
+    unsigned short work[288];           /* work area for inflate_table() */
+
+    /* literal/length table */
+    sym = 0;
+    while (sym < 144) lens[sym++] = 8;
+    while (sym < 256) lens[sym++] = 9;
+    while (sym < 280) lens[sym++] = 7;
+    while (sym < 288) lens[sym++] = 8;
+    next = fixed;
+    lenfix = next;
+    bits = 9;
+    inflate_table(LENS, lens, 288, &(next), &(bits), work);
+
+    /* distance table */
+    sym = 0;
+    while (sym < 32) lens[sym++] = 5;
+    distfix = next;
+    bits = 5;
+    inflate_table(DISTS, lens, 32, &(next), &(bits), work);
+}
+#endif /* BUILDFIXED */
+
 /*
    Return state with length and distance decoding tables and index sizes set to
    fixed code decoding.  Normally this returns fixed tables from inffixed.h.
    If BUILDFIXED is defined, then instead this routine builds the tables the
    first time it's called, and returns those tables the first time and
    thereafter.  This reduces the size of the code by about 2K bytes, in
-   exchange for a little execution time.  However, BUILDFIXED should not be
-   used for threaded applications, since the rewriting of the tables and virgin
-   may not be thread-safe.
+   exchange for a little execution time.  The tables are built with Z_ONCE(),
+   so BUILDFIXED is as thread-safe as Z_ONCE() is (see zutil.h).
  */
 local void fixedtables(state)
 struct inflate_state FAR *state;
 {
 #ifdef BUILDFIXED
-    static int virgin = 1;
-    static code *lenfix, *distfix;
-    static code fixed[544];
-
-    /* build fixed huffman tables if first call (may not be thread safe) */
-    if (virgin) {
-        unsigned sym, bits;
-        static code *next;
-
-        /* literal/length table */
-        sym = 0;
-        while (sym < 144) state->lens[sym++] = 8;
-        while (sym < 256) state->lens[sym++] = 9;
-        while (sym < 280) state->lens[sym++] = 7;
-        while (sym < 288) state->lens[sym++] = 8;
-        next = fixed;
-        lenfix = next;
-        bits = 9;
-        inflate_table(LENS, state->lens, 288, &(next), &(bits), state->work);
-
-        /* distance table */
-        sym = 0;
-        while (sym < 32) state->lens[sym++] = 5;
-        distfix = next;
-        bits = 5;
-        inflate_table(DISTS, state->lens, 32, &(next), &(bits), state->work);
-
-        /* do this just once */
-        virgin = 0;
-    }
+    Z_ONCE(&fixed_made, buildfixed);
 #else /* !BUILDFIXED */
 #   include "inffixed.h"
 #endif /* BUILDFIXED */
@@ -484,7 +491,7 @@ void FAR *out_desc;
                 RESTORE();
                 if (state->whave < state->wsize)
                     state->whave = state->wsize - left;
-                inflate_fast(strm, state->wsize);
+                z_kernels.inflate_fast(strm, state->wsize);
                 LOAD();
                 break;
             }
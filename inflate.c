@@ -93,8 +93,15 @@
 
 /* function prototypes */
 local void fixedtables OF((struct inflate_state FAR *state));
+#ifdef BUILDFIXED
+   local void buildfixed OF((void));
+#endif
 local int updatewindow OF((z_streamp strm, const unsigned char FAR *end,
-                           unsigned copy));
+                           unsigned copy, int check));
+local void windowcopy OF((struct inflate_state FAR *state,
+                          unsigned char FAR *dest,
+                          const unsigned char FAR *src, unsigned len,
+                          int check));
 #ifdef BUILDFIXED
    void makefixed OF((void));
 #endif
@@ -205,6 +212,7 @@ int stream_size;
 #else
         strm->zfree = zcfree;
 #endif
+    Z_KERNELS_INIT();
     state = (struct inflate_state FAR *)
             ZALLOC(strm, 1, sizeof(struct inflate_state));
     if (state == Z_NULL) return Z_MEM_ERROR;
@@ -248,50 +256,53 @@ int value;
     return Z_OK;
 }
 
+#ifdef BUILDFIXED
+local code FAR *lenfix, *distfix;
+local code fixed[544];
+local z_once_t fixed_made = Z_ONCE_INIT;
+
+/* Build the fixed tables.  This is only called once, through Z_ONCE(). */
+local void buildfixed()
+{
+    unsigned sym, bits;
+    code FAR *next;
+    unsigned short lens[288];           /* code lengths */
+    unsigned short work[288];           /* work area for inflate_table() */
+
+    /* literal/length table */
+    sym = 0;
+    while (sym < 144) lens[sym++] = 8;
+    while (sym < 256) lens[sym++] = 9;
+    while (sym < 280) lens[sym++] = 7;
+    while (sym < 288) lens[sym++] = 8;
+    next = fixed;
+    lenfix = next;
+    bits = 9;
+    inflate_table(LENS, lens, 288, &(next), &(bits), work);
+
+    /* distance table */
+    sym = 0;
+    while (sym < 32) lens[sym++] = 5;
+    distfix = next;
+    bits = 5;
+    inflate_table(DISTS, lens, 32, &(next), &(bits), work);
+}
+#endif /* BUILDFIXED */
+
 /*
    Return state with length and distance decoding tables and index sizes set to
    fixed code decoding.  Normally this returns fixed tables from inffixed.h.
    If BUILDFIXED is defined, then instead this routine builds the tables the
    first time it's called, and returns those tables the first time and
    thereafter.  This reduces the size of the code by about 2K bytes, in
-   exchange for a little execution time.  However, BUILDFIXED should not be
-   used for threaded applications, since the rewriting of the tables and virgin
-   may not be thread-safe.
+   exchange for a little execution time.  The tables are built with Z_ONCE(),
+   so BUILDFIXED is as thread-safe as Z_ONCE() is (see zutil.h).
  */
 local void fixedtables(state)
 struct inflate_state FAR *state;
 {
 #ifdef BUILDFIXED
-    static int virgin = 1;
-    static code *lenfix, *distfix;
-    static code fixed[544];
-
-    /* build fixed huffman tables if first call (may not be thread safe) */
-    if (virgin) {
-        unsigned sym, bits;
-        static code *next;
-
-        /* literal/length table */
-        sym = 0;
-        while (sym < 144) state->lens[sym++] = 8;
-        while (sym < 256) state->lens[sym++] = 9;
-        while (sym < 280) state->lens[sym++] = 7;
-        while (sym < 288) state->lens[sym++] = 8;
-        next = fixed;
-        lenfix = next;
-        bits = 9;
-        inflate_table(LENS, state->lens, 288, &(next), &(bits), state->work);
-
-        /* distance table */
-        sym = 0;
-        while (sym < 32) state->lens[sym++] = 5;
-        distfix = next;
-        bits = 5;
-        inflate_table(DISTS, state->lens, 32, &(next), &(bits), state->work);
-
-        /* do this just once */
-        virgin = 0;
-    }
+    Z_ONCE(&fixed_made, buildfixed);
 #else /* !BUILDFIXED */
 #   include "inffixed.h"
 #endif /* BUILDFIXED */
@@ -362,6 +373,19 @@ void makefixed()
 }
 #endif /* MAKEFIXED */
 
+/* check function to use adler32() for zlib or crc32() for gzip */
+#ifdef GUNZIP
+#  define UPDATE(check, buf, len) \
+    (state->flags ? crc32(check, buf, len) : adler32(check, buf, len))
+#  define UPDATE_COPY(check, dest, src, len) \
+    (state->flags ? copy_with_crc32(check, dest, src, len) : \
+                    copy_with_adler32(check, dest, src, len))
+#else
+#  define UPDATE(check, buf, len) adler32(check, buf, len)
+#  define UPDATE_COPY(check, dest, src, len) \
+    copy_with_adler32(check, dest, src, len)
+#endif
+
 /*
    Update the window with the last wsize (normally 32K) bytes written before
    returning.  If window does not exist yet, create it.  This is only called
@@ -375,16 +399,22 @@ void makefixed()
    upon return from inflate(), and since all distances after the first 32K of
    output will fall in the output data, making match copies simpler and faster.
    The advantage may be dependent on the size of the processor's data caches.
+
+   If check is true and there is a check value, all copy bytes are also run
+   through state->check.  The bytes that go to the window are checked as they
+   are copied, so that they are only brought into the cache once.
  */
-local int updatewindow(strm, end, copy)
+local int updatewindow(strm, end, copy, check)
 z_streamp strm;
 const Bytef *end;
 unsigned copy;
+int check;
 {
     struct inflate_state FAR *state;
     unsigned dist;
 
     state = (struct inflate_state FAR *)strm->state;
+    check = check && state->wrap;
 
     /* if it hasn't been done already, allocate space for the window */
     if (state->window == Z_NULL) {
@@ -403,17 +433,22 @@ unsigned copy;
 
     /* copy state->wsize or less output bytes into the circular window */
     if (copy >= state->wsize) {
-        zmemcpy(state->window, end - state->wsize, state->wsize);
+        if (check && copy > state->wsize)
+            state->check = UPDATE(state->check, end - copy,
+                                  copy - state->wsize);
+        windowcopy(state, state->window, end - state->wsize, state->wsize,
+                   check);
         state->wnext = 0;
         state->whave = state->wsize;
     }
     else {
         dist = state->wsize - state->wnext;
         if (dist > copy) dist = copy;
-        zmemcpy(state->window + state->wnext, end - copy, dist);
+        windowcopy(state, state->window + state->wnext, end - copy, dist,
+                   check);
         copy -= dist;
         if (copy) {
-            zmemcpy(state->window, end - copy, copy);
+            windowcopy(state, state->window, end - copy, copy, check);
             state->wnext = copy;
             state->whave = state->wsize;
         }
@@ -426,15 +461,24 @@ unsigned copy;
     return 0;
 }
 
-/* Macros for inflate(): */
+/*
+   Copy len bytes from src to dest in the window, and if check is true, run
+   them through state->check at the same time.
+ */
+local void windowcopy(state, dest, src, len, check)
+struct inflate_state FAR *state;
+unsigned char FAR *dest;
+const unsigned char FAR *src;
+unsigned len;
+int check;
+{
+    if (check)
+        state->check = UPDATE_COPY(state->check, dest, src, len);
+    else
+        zmemcpy(dest, src, len);
+}
 
-/* check function to use adler32() for zlib or crc32() for gzip */
-#ifdef GUNZIP
-#  define UPDATE(check, buf, len) \
-    (state->flags ? crc32(check, buf, len) : adler32(check, buf, len))
-#else
-#  define UPDATE(check, buf, len) adler32(check, buf, len)
-#endif
+/* Macros for inflate(): */
 
 /* check macros for header crc */
 #ifdef GUNZIP
@@ -1021,7 +1065,7 @@ int flush;
         case LEN:
             if (have >= 6 && left >= 258) {
                 RESTORE();
-                inflate_fast(strm, out);
+                z_kernels.inflate_fast(strm, out);
                 LOAD();
                 if (state->mode == TYPE)
                     state->back = -1;
@@ -1224,25 +1268,28 @@ int flush;
     /*
        Return from inflate(), updating the total counts and the check value.
        If there was no progress during the inflate() call, return a buffer
-       error.  Call updatewindow() to create and/or update the window state.
-       Note: a memory error from inflate() is non-recoverable.
+       error.  Call updatewindow() to create and/or update the window state,
+       which also updates the check value.  Note: a memory error from
+       inflate() is non-recoverable.
      */
   inf_leave:
     RESTORE();
-    if (state->wsize || (out != strm->avail_out && state->mode < BAD &&
-            (state->mode < CHECK || flush != Z_FINISH)))
-        if (updatewindow(strm, strm->next_out, out - strm->avail_out)) {
+    in -= strm->avail_in;
+    out -= strm->avail_out;
+    if (state->wsize || (out && state->mode < BAD &&
+            (state->mode < CHECK || flush != Z_FINISH))) {
+        if (updatewindow(strm, strm->next_out, out, 1)) {
             state->mode = MEM;
             return Z_MEM_ERROR;
         }
-    in -= strm->avail_in;
-    out -= strm->avail_out;
+    }
+    else if (state->wrap && out)
+        state->check = UPDATE(state->check, strm->next_out - out, out);
     strm->total_in += in;
     strm->total_out += out;
     state->total += out;
     if (state->wrap && out)
-        strm->adler = state->check =
-            UPDATE(state->check, strm->next_out - out, out);
+        strm->adler = state->check;
     strm->data_type = state->bits + (state->last ? 64 : 0) +
                       (state->mode == TYPE ? 128 : 0) +
                       (state->mode == LEN_ || state->mode == COPY_ ? 256 : 0);
@@ -1313,7 +1360,7 @@ uInt dictLength;
 
     /* copy dictionary to window using updatewindow(), which will amend the
        existing dictionary if appropriate */
-    ret = updatewindow(strm, dictionary + dictLength, dictLength);
+    ret = updatewindow(strm, dictionary + dictLength, dictLength, 0);
     if (ret) {
         state->mode = MEM;
         return Z_MEM_ERROR;
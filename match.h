@@ -0,0 +1,77 @@
+/* match.h -- hash chain search for longest_match()
+ * Copyright (C) 1995-2013 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* WARNING: this file should *not* be used by applications. It is
+   part of the implementation of the compression library and is
+   subject to change. Applications should only use zlib.h.
+ */
+
+/* This file is included by deflate.c once for each way of comparing strings.
+   LONGEST_MATCH is the name of the function to define, COMPARE256(a, b)
+   returns how many of the 256 bytes at a and b are the same before the first
+   difference, and LOAD16(p) loads two bytes from any address as a ush.  The
+   search and its result are exactly those of the byte-wise longest_match() in
+   deflate.c, so the compressed output does not depend on which comparison is
+   used.
+ */
+
+uInt ZLIB_INTERNAL LONGEST_MATCH(s, cur_match)
+    deflate_state *s;
+    IPos cur_match;                             /* current match */
+{
+    unsigned chain_length = s->max_chain_length;/* max hash chain length */
+    register Bytef *scan = s->window + s->strstart; /* current string */
+    register Bytef *match;                       /* matched string */
+    register int len;                           /* length of current match */
+    int best_len = s->prev_length;              /* best match length so far */
+    int nice_match = s->nice_match;             /* stop if match long enough */
+    IPos limit = s->strstart > (IPos)MAX_DIST(s) ?
+        s->strstart - (IPos)MAX_DIST(s) : NIL;
+    Posf *prev = s->prev;
+    uInt wmask = s->w_mask;
+    register ush scan_start = LOAD16(scan);
+    register ush scan_end   = LOAD16(scan+best_len-1);
+
+    Assert(s->hash_bits >= 8 && MAX_MATCH == 258, "Code too clever");
+
+    if (s->prev_length >= s->good_match) {
+        chain_length >>= 2;
+    }
+    if ((uInt)nice_match > s->lookahead) nice_match = s->lookahead;
+
+    Assert((ulg)s->strstart <= s->window_size-MIN_LOOKAHEAD, "need lookahead");
+
+    do {
+        Assert(cur_match < s->strstart, "no future");
+        match = s->window + cur_match;
+
+        /* Skip to the next match unless the two bytes at the end of the best
+         * match so far and the two at the start are the same.  These are the
+         * bytes that the byte-wise version checks first.
+         */
+        if (LOAD16(match+best_len-1) != scan_end ||
+            LOAD16(match) != scan_start) continue;
+
+        /* The comparison starts at scan[2], which the rolling hash makes
+         * equal to match[2] but the four-byte hash does not.
+         */
+        len = 2 + (int)COMPARE256(scan + 2, match + 2);
+        if (len > MAX_MATCH) len = MAX_MATCH;
+
+        if (len > best_len) {
+            s->match_start = cur_match;
+            best_len = len;
+            if (len >= nice_match) break;
+            scan_end = LOAD16(scan+best_len-1);
+        }
+    } while ((cur_match = prev[cur_match & wmask]) > limit
+             && --chain_length != 0);
+
+    if ((uInt)best_len <= s->lookahead) return (uInt)best_len;
+    return s->lookahead;
+}
+
+#undef LONGEST_MATCH
+#undef COMPARE256
@@ -0,0 +1,370 @@
+/* bench.c -- measure the speed of the zlib checksum routines
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+ * bench times crc32() and crc32c() on buffers of 4 KiB, 64 KiB, and 16 MiB,
+ * next to a four-table byte-slicing CRC built from get_crc_table(), which is
+ * what crc32() did on processors without faster instructions before it went
+ * to eight tables.  adler32() is
+ * timed on buffers from 64 bytes to 16 MiB, each at a few alignments, next
+ * to the portable sixteen-at-a-time loop.  The speed is reported in MB/s,
+ * and on x86 also in bytes per cycle of the time stamp counter.  deflate()
+ * is timed at levels 1, 6, 9, and 12 on generated text, where up to level 9
+ * most of the time goes to longest_match() -- build zlib with and without
+ * ASMV to compare the string comparisons with the assembler versions in
+ * contrib -- and at levels 0, 1, and 9 on random bytes, which are stored.
+ * The text is also compressed at levels 1 and 6 in 256-byte pieces, each
+ * ended with Z_SYNC_FLUSH, and with Z_HUFFMAN_ONLY both whole and in pieces.
+ *
+ * Usage:  bench [crc32] [adler32] [deflate] ...
+ * With no arguments, all of the benchmarks are run.
+ */
+
+/* @(#) $Id$ */
+
+#include "zlib.h"
+#include <stdio.h>
+#include <time.h>
+
+#ifdef STDC
+#  include <string.h>
+#  include <stdlib.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <x86intrin.h>
+#  define HAVE_RDTSC
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define HAVE_RDTSC
+#endif
+
+#define local static
+
+#define TOTAL (1UL << 30)       /* bytes to process for each measurement */
+#define MAXLEN (16UL << 20)     /* largest buffer size */
+#define MAXOFF 64               /* room for misaligning the buffer */
+#define TEXTLEN (1UL << 20)     /* size of the text to compress */
+#define TEXTREPS 16             /* times to compress it at each level */
+
+typedef uLong (*check_func) OF((uLong check, const Bytef *buf, uInt len));
+
+local void measure      OF((const char *name, check_func check,
+                            const Bytef *buf, uInt len));
+local uLong crc32_slice4 OF((uLong crc, const Bytef *buf, uInt len));
+local void bench_crc32  OF((const Bytef *buf));
+local uLong adler32_scalar OF((uLong adler, const Bytef *buf, uInt len));
+local void bench_adler32 OF((const Bytef *buf));
+local void make_text    OF((Bytef *text, uLong len));
+local void bench_deflate OF((Bytef *buf));
+int main                OF((int argc, char *argv[]));
+
+local const uInt sizes[] = {4096, 65536, 16777216};
+#define NSIZES (sizeof(sizes) / sizeof(sizes[0]))
+
+local const uInt adler_sizes[] = {64, 256, 4096, 65536, 16777216};
+#define NADLER_SIZES (sizeof(adler_sizes) / sizeof(adler_sizes[0]))
+
+local const unsigned offsets[] = {0, 1, 7, 32};
+#define NOFFSETS (sizeof(offsets) / sizeof(offsets[0]))
+
+/* ===========================================================================
+ * Run check over len bytes at buf enough times to process TOTAL bytes, and
+ * report the speed.
+ */
+local void measure(name, check, buf, len)
+    const char *name;
+    check_func check;
+    const Bytef *buf;
+    uInt len;
+{
+    unsigned long reps, n;
+    uLong val = 0;
+    clock_t start;
+    double secs;
+#ifdef HAVE_RDTSC
+    unsigned long long cycles;
+#endif
+
+    reps = TOTAL / len;
+    start = clock();
+#ifdef HAVE_RDTSC
+    cycles = __rdtsc();
+#endif
+    for (n = 0; n < reps; n++)
+        val = check(val, buf, len);
+#ifdef HAVE_RDTSC
+    cycles = __rdtsc() - cycles;
+#endif
+    secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (secs <= 0)
+        secs = 1e-6;
+    printf("%-11s %9u bytes: %8.1f MB/s", name, len,
+           (double)reps * len / secs / 1e6);
+#ifdef HAVE_RDTSC
+    printf("  %6.2f bytes/cycle", (double)reps * len / (double)cycles);
+#endif
+    printf("  (%08lx)\n", val);
+}
+
+/* ===========================================================================
+ * A four-table little-endian CRC, made here from the exported tables, to show
+ * what the eight tables used by crc32() when there is no faster way gain over
+ * it.  The result is the same as crc32() on a little-endian machine.
+ */
+local uLong crc32_slice4(crc, buf, len)
+    uLong crc;
+    const Bytef *buf;
+    uInt len;
+{
+    const z_crc_t FAR *tab = get_crc_table();
+    const z_crc_t FAR *t0 = tab, *t1 = tab + 256, *t2 = tab + 512,
+                      *t3 = tab + 768;
+    z_crc_t c;
+    z_crc_t w;
+
+    c = ~(z_crc_t)crc;
+    while (len && ((size_t)buf & 3)) {
+        c = t0[(c ^ *buf++) & 0xff] ^ (c >> 8);
+        len--;
+    }
+    while (len >= 4) {
+        memcpy(&w, buf, 4);
+        c ^= w;
+        c = t3[c & 0xff] ^ t2[(c >> 8) & 0xff] ^ t1[(c >> 16) & 0xff] ^
+            t0[c >> 24];
+        buf += 4;
+        len -= 4;
+    }
+    while (len--)
+        c = t0[(c ^ *buf++) & 0xff] ^ (c >> 8);
+    return (uLong)~c;
+}
+
+/* ===========================================================================
+ * Compare crc32() and crc32c() with the table-driven CRC.
+ */
+local void bench_crc32(buf)
+    const Bytef *buf;
+{
+    unsigned i;
+    int little = 1;
+
+    for (i = 0; i < NSIZES; i++) {
+        measure("crc32", crc32, buf, sizes[i]);
+        measure("crc32c", crc32c, buf, sizes[i]);
+        if (*(char *)&little)
+            measure("slice-by-4", crc32_slice4, buf, sizes[i]);
+    }
+}
+
+/* ===========================================================================
+ * The sixteen-at-a-time Adler-32 used by adler32() when there is no faster
+ * way.
+ */
+#define BASE 65521
+#define NMAX 5552
+
+local uLong adler32_scalar(adler, buf, len)
+    uLong adler;
+    const Bytef *buf;
+    uInt len;
+{
+    unsigned long sum2 = (adler >> 16) & 0xffff;
+    unsigned n, k;
+
+    adler &= 0xffff;
+    while (len) {
+        n = len < NMAX ? len : NMAX;
+        len -= n;
+        while (n >= 16) {
+            for (k = 0; k < 16; k++) {
+                adler += buf[k];
+                sum2 += adler;
+            }
+            buf += 16;
+            n -= 16;
+        }
+        while (n--) {
+            adler += *buf++;
+            sum2 += adler;
+        }
+        adler %= BASE;
+        sum2 %= BASE;
+    }
+    return adler | (sum2 << 16);
+}
+
+/* ===========================================================================
+ * Compare adler32() with the portable loop, at several alignments.
+ */
+local void bench_adler32(buf)
+    const Bytef *buf;
+{
+    unsigned i, j;
+    char name[32];
+
+    for (i = 0; i < NADLER_SIZES; i++)
+        for (j = 0; j < NOFFSETS; j++) {
+            sprintf(name, "adler32+%u", offsets[j]);
+            measure(name, adler32, buf + offsets[j], adler_sizes[i]);
+            if (j == 0)
+                measure("portable", adler32_scalar, buf, adler_sizes[i]);
+        }
+}
+
+/* ===========================================================================
+ * Fill text with len bytes of words drawn from a small vocabulary, with short
+ * words more likely than long ones, so that the text compresses about as
+ * well as English does.
+ */
+local void make_text(text, len)
+    Bytef *text;
+    uLong len;
+{
+    static const char *const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "compression", "dictionary", "window", "stream", "literal", "match",
+        "distance", "length", "Huffman", "deflate", "inflate", "block"};
+    unsigned long rnd = 1;
+    uLong n = 0;
+    const char *word;
+    unsigned k;
+
+    while (n < len) {
+        rnd = rnd * 1103515245UL + 12345;
+        k = (unsigned)(rnd >> 16) % (sizeof(words) / sizeof(words[0]));
+        k = (k * k) / (sizeof(words) / sizeof(words[0]));
+        for (word = words[k]; *word && n < len; word++)
+            text[n++] = (Bytef)*word;
+        if (n < len)
+            text[n++] = (Bytef)((rnd >> 24) % 13 == 0 ? '\n' : ' ');
+    }
+}
+
+/* ===========================================================================
+ * Time deflate() on TEXTLEN bytes of text at a few levels, with Z_QUICK, and
+ * with Z_HUFFMAN_ONLY, and on as many random bytes, compressing them TEXTREPS
+ * times with each, and report the speed and the compressed size.  The text
+ * is also compressed in pieces with Z_SYNC_FLUSH, as messages are, where
+ * building the Huffman trees for each small block takes much of the time.
+ */
+local void bench_deflate(buf)
+    Bytef *buf;
+{
+    static const int levels[] = {1, 1, 6, 9, Z_OPTIMAL_COMPRESSION, 0, 1, 9,
+                                 1, 6, 6, 6};
+    static const int strategies[] = {Z_QUICK, Z_DEFAULT_STRATEGY,
+                                     Z_DEFAULT_STRATEGY, Z_DEFAULT_STRATEGY,
+                                     Z_DEFAULT_STRATEGY, Z_DEFAULT_STRATEGY,
+                                     Z_DEFAULT_STRATEGY, Z_DEFAULT_STRATEGY,
+                                     Z_DEFAULT_STRATEGY, Z_DEFAULT_STRATEGY,
+                                     Z_HUFFMAN_ONLY, Z_HUFFMAN_ONLY};
+    static const int random[] = {0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0};
+    static const uInt pieces[] = {0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 256};
+    Bytef *text = buf, *comp = buf + TEXTLEN;
+    Bytef *bytes = buf + MAXLEN - TEXTLEN;      /* left random by main() */
+    z_stream strm;
+    unsigned i, n;
+    uLong left;
+    clock_t start;
+    double secs;
+    char name[32];
+
+    make_text(text, TEXTLEN);
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    for (i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        if (deflateInit2(&strm, levels[i], Z_DEFLATED, MAX_WBITS, 8,
+                         strategies[i]) != Z_OK) {
+            fprintf(stderr, "bench: deflateInit2 failed\n");
+            return;
+        }
+        start = clock();
+        for (n = 0; n < TEXTREPS; n++) {
+            deflateReset(&strm);
+            strm.next_in = random[i] ? bytes : text;
+            strm.next_out = comp;
+            strm.avail_out = (uInt)(MAXLEN - 2 * TEXTLEN);
+            left = TEXTLEN;
+            while (pieces[i] != 0 && left > pieces[i]) {
+                strm.avail_in = pieces[i];
+                left -= pieces[i];
+                deflate(&strm, Z_SYNC_FLUSH);
+            }
+            strm.avail_in = (uInt)left;
+            if (deflate(&strm, Z_FINISH) != Z_STREAM_END) {
+                fprintf(stderr, "bench: deflate failed\n");
+                deflateEnd(&strm);
+                return;
+            }
+        }
+        secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (secs <= 0)
+            secs = 1e-6;
+        if (strategies[i] == Z_QUICK)
+            strcpy(name, "deflate -q");
+        else if (strategies[i] == Z_HUFFMAN_ONLY)
+            sprintf(name, pieces[i] != 0 ? "sync%u -h" : "deflate -h",
+                    pieces[i]);
+        else if (pieces[i] != 0)
+            sprintf(name, "sync%u -%d", pieces[i], levels[i]);
+        else
+            sprintf(name, "%s -%d", random[i] ? "random" : "deflate",
+                    levels[i]);
+        printf("%-11s %9lu bytes: %8.1f MB/s  -> %lu bytes\n", name,
+               TEXTLEN, (double)TEXTREPS * TEXTLEN / secs / 1e6,
+               strm.total_out);
+        deflateEnd(&strm);
+    }
+}
+
+/* ===========================================================================
+ * Usage:  bench [crc32] [adler32] [deflate] ...
+ */
+int main(argc, argv)
+    int argc;
+    char *argv[];
+{
+    Bytef *buf;
+    unsigned long n, rnd;
+    int i, all;
+
+    buf = (Bytef *)malloc(MAXLEN + MAXOFF);
+    if (buf == Z_NULL) {
+        fprintf(stderr, "bench: out of memory\n");
+        return 1;
+    }
+    rnd = 1;
+    for (n = 0; n < MAXLEN + MAXOFF; n++) {
+        rnd = rnd * 1103515245UL + 12345;
+        buf[n] = (Bytef)(rnd >> 16);
+    }
+
+    all = argc < 2;
+    for (i = 1; i < argc; i++)
+        if (strcmp(argv[i], "crc32") != 0 &&
+            strcmp(argv[i], "adler32") != 0 &&
+            strcmp(argv[i], "deflate") != 0) {
+            fprintf(stderr, "bench: unknown benchmark %s\n", argv[i]);
+            return 1;
+        }
+    for (i = 1; all || i < argc; i++) {
+        if (all || strcmp(argv[i], "crc32") == 0)
+            bench_crc32(buf);
+        if (all || strcmp(argv[i], "adler32") == 0)
+            bench_adler32(buf);
+        if (all || strcmp(argv[i], "deflate") == 0)
+            bench_deflate(buf);
+        if (all)
+            break;
+    }
+    free(buf);
+    return 0;
+}
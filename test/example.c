@@ -47,6 +47,37 @@ void test_sync          OF((Byte *compr, uLong comprLen,
 void test_dict_deflate  OF((Byte *compr, uLong comprLen));
 void test_dict_inflate  OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
+void test_crc32_combine OF((Byte *buf, uLong len));
+void run_backwards      OF((voidpf opaque, z_work_func work, voidpf arg,
+                            unsigned count));
+void test_parallel      OF((void));
+void test_crc32c        OF((Byte *buf, uLong len));
+void test_iov           OF((Byte *buf, uLong len));
+void test_hash          OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_big_hash      OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void check_inflate      OF((Byte *compr, uLong comprLen, Byte *uncompr,
+                            uLong len, int windowBits, uLong *end,
+                            const char *what));
+void fill_mixed         OF((Byte *buf, uLong len, uLong period, uLong noise,
+                            unsigned letters));
+void test_quick         OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_insert_limit  OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_raw           OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_stored        OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_optimal       OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_prime         OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_split         OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_huff          OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
 int  main               OF((int argc, char *argv[]));
 
 
@@ -538,6 +569,734 @@ void test_dict_inflate(compr, comprLen, uncompr, uncomprLen)
     }
 }
 
+/* ===========================================================================
+ * Test crc32_combine(), and crc32_combine_op() with a reused operator
+ */
+void test_crc32_combine(buf, len)
+    Byte *buf;
+    uLong len;
+{
+    uLong crc, crc1, crc2, op, piece, n;
+
+    for (n = 0; n < len; n++)
+        buf[n] = (Byte)(n * 7 + (n >> 9));
+    crc = crc32(0L, buf, (uInt)len);
+
+    for (n = 0; n <= len; n += len / 7) {
+        crc1 = crc32(0L, buf, (uInt)n);
+        crc2 = crc32(0L, buf + n, (uInt)(len - n));
+        if (crc32_combine(crc1, crc2, (z_off_t)(len - n)) != crc) {
+            fprintf(stderr, "bad crc32_combine at %lu\n", n);
+            exit(1);
+        }
+    }
+
+    piece = len / 10;
+    op = crc32_combine_gen((z_off_t)piece);
+    crc1 = crc32(0L, Z_NULL, 0);
+    for (n = 0; n + piece <= len; n += piece)
+        crc1 = crc32_combine_op(crc1, crc32(0L, buf + n, (uInt)piece), op);
+    if (crc1 != crc32(0L, buf, (uInt)n)) {
+        fprintf(stderr, "bad crc32_combine_op\n");
+        exit(1);
+    }
+    printf("crc32_combine(): OK\n");
+}
+
+/* ===========================================================================
+ * A stand-in for a thread pool: do the work in reverse order, and record how
+ * many pieces there were
+ */
+void run_backwards(opaque, work, arg, count)
+    voidpf opaque;
+    z_work_func work;
+    voidpf arg;
+    unsigned count;
+{
+    *(unsigned *)opaque = count;
+    while (count)
+        work(arg, --count);
+}
+
+/* ===========================================================================
+ * Test crc32_parallel() and adler32_parallel() against crc32() and adler32()
+ */
+void test_parallel()
+{
+    uLong len = 5000001L, n, crc, adler;
+    unsigned pieces = 0;
+    Byte *buf;
+
+    buf = (Byte*)calloc((uInt)len, 1);
+    if (buf == Z_NULL) {
+        printf("out of memory\n");
+        exit(1);
+    }
+    for (n = 0; n < len; n++)
+        buf[n] = (Byte)(n * 13 + (n >> 11));
+    crc = crc32(crc32(0L, Z_NULL, 0), buf, (uInt)len);
+    adler = adler32(adler32(0L, Z_NULL, 0), buf, (uInt)len);
+
+    if (crc32_parallel(0L, buf, len, 4, run_backwards, &pieces) != crc ||
+        pieces != 4) {
+        fprintf(stderr, "bad crc32_parallel\n");
+        exit(1);
+    }
+    if (adler32_parallel(1L, buf, len, 64, run_backwards, &pieces) != adler ||
+        pieces != 4) {
+        fprintf(stderr, "bad adler32_parallel\n");
+        exit(1);
+    }
+    if (crc32_parallel(0L, buf, len, 3, Z_NULL, Z_NULL) != crc ||
+        adler32_parallel(1L, buf, len, 1, Z_NULL, Z_NULL) != adler) {
+        fprintf(stderr, "bad serial crc32_parallel or adler32_parallel\n");
+        exit(1);
+    }
+    free(buf);
+    printf("crc32_parallel(), adler32_parallel(): OK\n");
+}
+
+/* ===========================================================================
+ * Test crc32c() against a bit at a time CRC-32C, and crc32c_combine()
+ */
+void test_crc32c(buf, len)
+    Byte *buf;
+    uLong len;
+{
+    uLong crc, bits, n;
+    int k;
+
+    if (crc32c(0L, (const Bytef *)"123456789", 9) != 0xe3069283UL) {
+        fprintf(stderr, "bad crc32c check value\n");
+        exit(1);
+    }
+
+    for (n = 0; n < len; n++)
+        buf[n] = (Byte)(n * 11 + (n >> 7));
+    bits = 0xffffffffUL;
+    for (n = 0; n < len; n++) {
+        bits ^= buf[n];
+        for (k = 0; k < 8; k++)
+            bits = bits & 1 ? (bits >> 1) ^ 0x82f63b78UL : bits >> 1;
+    }
+    bits ^= 0xffffffffUL;
+    crc = crc32c(crc32c(0L, Z_NULL, 0), buf + 1, (uInt)len - 1);
+    if (crc32c(crc32c(0L, buf, 1), buf + 1, (uInt)len - 1) != bits ||
+        crc32c_combine(crc32c(0L, buf, 1), crc, (z_off_t)len - 1) != bits) {
+        fprintf(stderr, "bad crc32c\n");
+        exit(1);
+    }
+    printf("crc32c(): OK\n");
+}
+
+/* ===========================================================================
+ * Test crc32_iov() and adler32_iov() on segments of assorted lengths
+ */
+void test_iov(buf, len)
+    Byte *buf;
+    uLong len;
+{
+    z_iovec iov[200];
+    unsigned count;
+    uLong n, k;
+
+    for (n = 0; n < len; n++)
+        buf[n] = (Byte)(n * 5 + (n >> 10));
+    n = 0;
+    for (count = 0; count < 200 && n < len; count++) {
+        k = (count * count * 37 + 3) % 700;     /* 0 to 699 */
+        if (k > len - n)
+            k = len - n;
+        iov[count].base = buf + n;
+        iov[count].len = k;
+        n += k;
+    }
+    if (crc32_iov(0L, iov, count) != crc32(0L, buf, (uInt)n) ||
+        adler32_iov(1L, iov, count) != adler32(1L, buf, (uInt)n) ||
+        crc32_iov(0L, Z_NULL, 0) != crc32(0L, Z_NULL, 0) ||
+        adler32_iov(0L, Z_NULL, 0) != adler32(0L, Z_NULL, 0)) {
+        fprintf(stderr, "bad crc32_iov or adler32_iov\n");
+        exit(1);
+    }
+    printf("crc32_iov(), adler32_iov(): OK\n");
+}
+
+/* ===========================================================================
+ * Inflate the comprLen bytes at compr, with windowBits as for inflateInit2(),
+ * into uncompr + len, and check that they are the len bytes at uncompr.  If
+ * end is not Z_NULL, inflate a block at a time, and set *end to the number of
+ * bytes out at the end of the first block.  On error, report the bad deflate
+ * as what.
+ */
+void check_inflate(compr, comprLen, uncompr, len, windowBits, end, what)
+    Byte *compr, *uncompr;
+    uLong comprLen, len;
+    int windowBits;
+    uLong *end;
+    const char *what;
+{
+    z_stream d_stream; /* decompression stream */
+    int err;
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+    d_stream.next_in = compr;
+    d_stream.avail_in = (uInt)comprLen;
+    d_stream.next_out = uncompr + len;
+    d_stream.avail_out = (uInt)len;
+
+    err = inflateInit2(&d_stream, windowBits);
+    CHECK_ERR(err, "inflateInit2");
+    if (end != Z_NULL) {
+        *end = 0;
+        do {
+            err = inflate(&d_stream, Z_BLOCK);
+            if (err == Z_OK && (d_stream.data_type & 128) && *end == 0)
+                *end = d_stream.total_out;
+        } while (err == Z_OK);
+    }
+    else
+        err = inflate(&d_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "inflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+    if (d_stream.total_out != len ||
+        memcmp(uncompr, uncompr + len, (size_t)len)) {
+        fprintf(stderr, "bad deflate %s\n", what);
+        exit(1);
+    }
+}
+
+/* ===========================================================================
+ * Test deflate() with the four-byte hash on lines that repeat with small
+ * changes, in the first half of uncompr, and inflate into the second half
+ */
+void test_hash(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+#ifdef ASMV
+    fprintf(stderr, "ASMV -- the four-byte hash is not available\n");
+#else
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2, n;
+
+    for (n = 0; n < len; n++)
+        uncompr[n] = (Byte)("{\"id\":7,\"key\":\"value\"}\n"[n % 24] +
+                            (n % 24 == 6 ? (n / 24) % 10 : 0));
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, 6);
+    CHECK_ERR(err, "deflateInit");
+    err = deflateHash(&c_stream, Z_HASH_FOUR);
+    CHECK_ERR(err, "deflateHash");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len / 2;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_SYNC_FLUSH);
+    CHECK_ERR(err, "deflate");
+    if (deflateHash(&c_stream, Z_HASH_ROLLING) != Z_STREAM_ERROR) {
+        fprintf(stderr, "deflateHash should fail after deflate\n");
+        exit(1);
+    }
+    c_stream.avail_in = (uInt)(len - len / 2);
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "with Z_HASH_FOUR");
+    printf("deflateHash(Z_HASH_FOUR): OK\n");
+#endif
+}
+
+/* ===========================================================================
+ * Test deflate() with the largest hash table, in one call
+ */
+void test_big_hash(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2;
+
+    fill_mixed(uncompr, len, len, 0, 12);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    if (deflateInit2(&c_stream, 9, Z_DEFLATED, MAX_WBITS, MAX_HASH_LEVEL + 1,
+                     Z_DEFAULT_STRATEGY) != Z_STREAM_ERROR) {
+        fprintf(stderr, "deflateInit2 should reject memLevel %d\n",
+                MAX_HASH_LEVEL + 1);
+        exit(1);
+    }
+    err = deflateInit2(&c_stream, 9, Z_DEFLATED, MAX_WBITS, MAX_HASH_LEVEL,
+                       Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateInit2");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "with the largest memLevel");
+    printf("deflate(memLevel %d): OK\n", MAX_HASH_LEVEL);
+}
+
+/* ===========================================================================
+ * Fill buf with len pseudo-random bytes: the first noise bytes of every
+ * period are random, and the rest are picked from the first letters of hello
+ */
+void fill_mixed(buf, len, period, noise, letters)
+    Byte *buf;
+    uLong len, period, noise;
+    unsigned letters;
+{
+    uLong n, r = 1;
+
+    for (n = 0; n < len; n++) {
+        r = r * 1103515245UL + 12345;
+        buf[n] = n % period < noise ? (Byte)(r >> 16) :
+                                      (Byte)hello[(r >> 16) % letters];
+    }
+}
+
+/* ===========================================================================
+ * Test deflate() with Z_QUICK, switching to and from it with deflateParams()
+ */
+void test_quick(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2;
+
+    fill_mixed(uncompr, len, 1000, 100, 6);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit2(&c_stream, 1, Z_DEFLATED, MAX_WBITS, 1, Z_QUICK);
+    CHECK_ERR(err, "deflateInit2");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len / 3;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "deflate");
+    err = deflateParams(&c_stream, Z_DEFAULT_COMPRESSION, Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)len / 3;
+    err = deflate(&c_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "deflate");
+    err = deflateParams(&c_stream, 1, Z_QUICK);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)(len - 2 * (len / 3));
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "with Z_QUICK");
+    printf("deflate(Z_QUICK): OK\n");
+}
+
+/* ===========================================================================
+ * Test deflate() with a short insert limit on repeated records, at levels 6,
+ * 9, and 1 in turn
+ */
+void test_insert_limit(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2, n;
+
+    for (n = 0; n < len; n++)
+        uncompr[n] = (Byte)("{\"id\":7,\"key\":\"value\"}\n"[n % 24] +
+                            (n % 240 == 6 ? (n / 240) % 10 : 0));
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, 6);
+    CHECK_ERR(err, "deflateInit");
+    if (deflateInsertLimit(&c_stream, 259) != Z_STREAM_ERROR) {
+        fprintf(stderr, "deflateInsertLimit should reject 259\n");
+        exit(1);
+    }
+    err = deflateInsertLimit(&c_stream, 16);
+    CHECK_ERR(err, "deflateInsertLimit");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len / 3;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "deflate");
+    err = deflateParams(&c_stream, 9, Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)len / 3;
+    err = deflate(&c_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "deflate");
+    err = deflateParams(&c_stream, 1, Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)(len - 2 * (len / 3));
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "with deflateInsertLimit");
+    printf("deflateInsertLimit(): OK\n");
+}
+
+/* ===========================================================================
+ * Test deflate() on random bytes followed by text, with blocks of only 128
+ * symbols: after the first one, the random bytes are stored in blocks as
+ * large as pending_buf permits
+ */
+void test_raw(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2, rlen = len / 2;
+
+    fill_mixed(uncompr, len, len, rlen, 12);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit2(&c_stream, 9, Z_DEFLATED, MAX_WBITS, 1,
+                       Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateInit2");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)rlen;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_FULL_FLUSH);
+    CHECK_ERR(err, "deflate");
+    if (c_stream.total_out > rlen + rlen / 64) {
+        fprintf(stderr, "deflate stored %lu random bytes in %lu\n", rlen,
+                c_stream.total_out);
+        exit(1);
+    }
+    c_stream.avail_in = (uInt)(len - rlen);
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+    if (c_stream.total_out > rlen + (len - rlen) / 4 * 3) {
+        fprintf(stderr, "deflate did not compress the text after the random "
+                "bytes\n");
+        exit(1);
+    }
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "of random bytes and text");
+    printf("deflate(random, text): OK\n");
+}
+
+/* ===========================================================================
+ * Test deflate() at level 0 with a small window and pending buffer, so that
+ * the input is copied straight to the output and replaces the window, and
+ * then at level 9, which must find its matches in that window
+ */
+void test_stored(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2, n;
+
+    /* random bytes repeated every 258, the longest match, so that FASTEST,
+       which inserts only the strings it searches, finds them too */
+    fill_mixed(uncompr, 258, 258, 258, 1);
+    for (n = 258; n < len; n++)
+        uncompr[n] = uncompr[n - 258];
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit2(&c_stream, Z_NO_COMPRESSION, Z_DEFLATED, 10, 1,
+                       Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateInit2");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len / 2;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "deflate");
+    err = deflateParams(&c_stream, Z_BEST_COMPRESSION, Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)(len - len / 2);
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+    if (c_stream.total_out > len / 2 + len / 8) {
+        fprintf(stderr, "deflate did not match the data stored at level 0\n");
+        exit(1);
+    }
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "at level 0 and then 9");
+    printf("deflate(level 0, 9): OK\n");
+}
+
+/* ===========================================================================
+ * Test deflate() at Z_OPTIMAL_COMPRESSION, switching to it with
+ * deflateParams() and with little output space at a time
+ */
+void test_optimal(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2;
+
+    fill_mixed(uncompr, len, 1000, 100, 6);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len / 4;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "deflate");
+    err = deflateParams(&c_stream, Z_OPTIMAL_COMPRESSION, Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)(len - len / 4);
+    do {
+        c_stream.avail_out = 100;
+        err = deflate(&c_stream, Z_FINISH);
+    } while (err == Z_OK);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "at Z_OPTIMAL_COMPRESSION");
+    printf("deflate(Z_OPTIMAL_COMPRESSION): OK\n");
+}
+
+/* ===========================================================================
+ * Test deflatePrime() at the start of a raw deflate stream, and that
+ * deflatePending() reports fewer than eight bits whatever the bit buffer
+ * holds, with little output space at a time
+ */
+void test_prime(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err, bits;
+    unsigned pending;
+    uLong len = uncomprLen / 2;
+
+    fill_mixed(uncompr, len, len, 0, 13);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit2(&c_stream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8,
+                       Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateInit2");
+
+    /* an empty static block that is not the last: the three header bits,
+       and the seven zero bits of the end of block code */
+    err = deflatePrime(&c_stream, 10, 2);
+    CHECK_ERR(err, "deflatePrime");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len;
+    c_stream.next_out = compr;
+    do {
+        c_stream.avail_out = 7;
+        err = deflate(&c_stream, Z_FINISH);
+        if (deflatePending(&c_stream, &pending, &bits) != Z_OK ||
+            bits < 0 || bits > 7) {
+            fprintf(stderr, "deflatePending reported %d bits\n", bits);
+            exit(1);
+        }
+    } while (err == Z_OK && c_stream.total_out < comprLen - 7);
+    if (err != Z_STREAM_END || pending != 0 || bits != 0) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, -MAX_WBITS, Z_NULL,
+                  "after deflatePrime()");
+    printf("deflatePrime(), deflatePending(): OK\n");
+}
+
+/* ===========================================================================
+ * Test that deflate() ends a block where the kind of data changes, well before
+ * the symbol buffer is full
+ */
+void test_split(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = 16000, text = 12000, n, end = 0;
+
+    if (uncomprLen < 2 * len) {
+        fprintf(stderr, "buffer too small for test_split\n");
+        exit(1);
+    }
+    fill_mixed(uncompr, text, text, 0, 13);
+    fill_mixed(uncompr + text, len - text, len, len, 1);
+    for (n = text; n < len; n++)
+        uncompr[n] = (Byte)(0x80 + (uncompr[n] & 0x0f) * 2);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit2(&c_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                       -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateInit2");
+
+    c_stream.next_in = uncompr;
+    c_stream.avail_in = (uInt)len;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, -MAX_WBITS, &end,
+                  "of mixed data");
+    if (end < text || end > text + 2048) {
+        fprintf(stderr, "first block ends at %lu, not at %lu\n", end, text);
+        exit(1);
+    }
+    printf("deflate() block split: OK\n");
+}
+
+/* ===========================================================================
+ * Test deflate() with Z_HUFFMAN_ONLY on input given in pieces both smaller
+ * and larger than a block, with a flush, then switching away from it with
+ * deflateParams() and finishing with little output space at a time
+ */
+void test_huff(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    int err;
+    uLong len = uncomprLen / 2, n, piece;
+
+    fill_mixed(uncompr, len / 2, len, 0, 13);
+    fill_mixed(uncompr + len / 2, len - len / 2, len, 0, 6);
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit2(&c_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                       MAX_WBITS, 1, Z_HUFFMAN_ONLY);
+    CHECK_ERR(err, "deflateInit2");
+
+    c_stream.next_in = uncompr;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    for (n = 0; n < len * 3 / 4; n += piece) {
+        piece = 1 + n % 313;
+        c_stream.avail_in = (uInt)piece;
+        err = deflate(&c_stream, n < len / 2 ? Z_NO_FLUSH : Z_SYNC_FLUSH);
+        CHECK_ERR(err, "deflate");
+    }
+    err = deflateParams(&c_stream, Z_DEFAULT_COMPRESSION,
+                        Z_DEFAULT_STRATEGY);
+    CHECK_ERR(err, "deflateParams");
+    c_stream.avail_in = (uInt)(len - n);
+    do {
+        c_stream.avail_out = 100;
+        err = deflate(&c_stream, Z_FINISH);
+    } while (err == Z_OK);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    check_inflate(compr, c_stream.total_out, uncompr, len, MAX_WBITS, Z_NULL,
+                  "with Z_HUFFMAN_ONLY");
+    printf("deflate(Z_HUFFMAN_ONLY): OK\n");
+}
+
 /* ===========================================================================
  * Usage:  example [output.gz  [input.gz]]
  */
@@ -594,6 +1353,21 @@ int main(argc, argv)
     test_dict_deflate(compr, comprLen);
     test_dict_inflate(compr, comprLen, uncompr, uncomprLen);
 
+    test_crc32_combine(uncompr, uncomprLen);
+    test_parallel();
+    test_crc32c(uncompr, uncomprLen);
+    test_iov(uncompr, uncomprLen);
+    test_hash(compr, comprLen, uncompr, uncomprLen);
+    test_big_hash(compr, comprLen, uncompr, uncomprLen);
+    test_quick(compr, comprLen, uncompr, uncomprLen);
+    test_insert_limit(compr, comprLen, uncompr, uncomprLen);
+    test_raw(compr, comprLen, uncompr, uncomprLen);
+    test_stored(compr, comprLen, uncompr, uncomprLen);
+    test_optimal(compr, comprLen, uncompr, uncomprLen);
+    test_prime(compr, comprLen, uncompr, uncomprLen);
+    test_split(compr, comprLen, uncompr, uncomprLen);
+    test_huff(compr, comprLen, uncompr, uncomprLen);
+
     free(compr);
     free(uncompr);
 
@@ -0,0 +1,36 @@
+/* maketables.c -- write out crc32.h and trees.h
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+ * maketables is linked against a copy of the zlib sources compiled with
+ * MAKECRCH and GEN_TREES_H defined.  It asks for the CRC tables and starts a
+ * deflate stream, which computes the tables at run time and writes them out
+ * as crc32.h and trees.h in the current directory.  The results should be
+ * identical to the headers distributed with zlib -- if the table code in
+ * crc32.c or trees.c is changed, the headers are regenerated this way and
+ * copied back into the source directory.
+ */
+
+/* @(#) $Id$ */
+
+#include "zlib.h"
+#include <stdio.h>
+
+int main OF((void));
+
+int main()
+{
+    z_stream strm;
+
+    get_crc_table();
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    if (deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        fprintf(stderr, "maketables: deflateInit failed\n");
+        return 1;
+    }
+    deflateEnd(&strm);
+    return 0;
+}
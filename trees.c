@@ -59,6 +59,12 @@
 #define REPZ_11_138  18
 /* repeat a zero length 11-138 times  (7 bits of repeat count) */
 
+#define SPLIT_SYMS 512
+/* number of symbols between two looks at the statistics by _tr_split() */
+
+#define SPLIT_MIN_BYTES 10000
+/* no block is ended early before it covers this many bytes of input */
+
 local const int extra_lbits[LENGTH_CODES] /* extra bits for each length code */
    = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
 
@@ -110,6 +116,9 @@ local int base_length[LENGTH_CODES];
 local int base_dist[D_CODES];
 /* First normalized distance for each code (0 = distance of 1) */
 
+local z_once_t static_init_done = Z_ONCE_INIT;
+/* the tables above are made once, by tr_static_make() */
+
 #else
 #  include "trees.h"
 #endif /* GEN_TREES_H */
@@ -136,8 +145,12 @@ local static_tree_desc  static_bl_desc =
  */
 
 local void tr_static_init OF((void));
+#if defined(GEN_TREES_H) || !defined(STDC)
+local void tr_static_make OF((void));
+#endif
 local void init_block     OF((deflate_state *s));
 local void pqdownheap     OF((deflate_state *s, ct_data *tree, int k));
+local void sort_tree      OF((deflate_state *s, ct_data *tree, int elems));
 local void gen_bitlen     OF((deflate_state *s, tree_desc *desc));
 local void gen_codes      OF((ct_data *tree, int max_code, ushf *bl_count));
 local void build_tree     OF((deflate_state *s, tree_desc *desc));
@@ -146,8 +159,12 @@ local void send_tree      OF((deflate_state *s, ct_data *tree, int max_code));
 local int  build_bl_tree  OF((deflate_state *s));
 local void send_all_trees OF((deflate_state *s, int lcodes, int dcodes,
                               int blcodes));
+local int  split_end      OF((deflate_state *s, const unsigned *count,
+                              ulg bytes));
 local void compress_block OF((deflate_state *s, const ct_data *ltree,
                               const ct_data *dtree));
+local void compress_lits  OF((deflate_state *s, const ct_data *ltree,
+                              const uch *buf, ulg len));
 local int  detect_data_type OF((deflate_state *s));
 local unsigned bi_reverse OF((unsigned value, int length));
 local void bi_windup      OF((deflate_state *s));
@@ -178,33 +195,59 @@ local void gen_trees_header OF((void));
     put_byte(s, (uch)((ush)(w) >> 8)); \
 }
 
+/* ===========================================================================
+ * Output the full bit buffer w LSB first on the stream.  A 64-bit buffer is
+ * written with a single unaligned store where the byte order allows it.
+ * IN assertion: there is enough room in pendingBuf.
+ */
+#if Buf_size == 64
+#  if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#    define put_word(s, w) { \
+    bi_word bw = (w); \
+    zmemcpy(s->pending_buf + s->pending, &bw, 8); \
+    s->pending += 8; \
+}
+#  else
+#    define put_word(s, w) { \
+    put_short(s, (ush)(w)); \
+    put_short(s, (ush)((w) >> 16)); \
+    put_short(s, (ush)((w) >> 32)); \
+    put_short(s, (ush)((w) >> 48)); \
+}
+#  endif
+#else
+#  define put_word(s, w) put_short(s, w)
+#endif
+
 /* ===========================================================================
  * Send a value on a given number of bits.
- * IN assertion: length <= 16 and value fits in length bits.
+ * IN assertion: length < Buf_size and value fits in length bits.
  */
 #ifdef DEBUG
-local void send_bits      OF((deflate_state *s, int value, int length));
+local void send_bits      OF((deflate_state *s, bi_word value, int length));
 
 local void send_bits(s, value, length)
     deflate_state *s;
-    int value;  /* value to send */
-    int length; /* number of bits */
+    bi_word value;  /* value to send */
+    int length;     /* number of bits */
 {
-    Tracevv((stderr," l %2d v %4x ", length, value));
-    Assert(length > 0 && length <= 15, "invalid length");
+    Tracevv((stderr," l %2d v %4lx ", length, (ulg)value));
+    Assert(length > 0 && length < Buf_size, "invalid length");
     s->bits_sent += (ulg)length;
 
     /* If not enough room in bi_buf, use (valid) bits from bi_buf and
-     * (16 - bi_valid) bits from value, leaving (width - (16-bi_valid))
-     * unused bits in value.
+     * (Buf_size - bi_valid) bits from value, leaving (width -
+     * (Buf_size - bi_valid)) unused bits in value.  bi_buf is written as
+     * soon as it is full, so bi_valid stays below Buf_size and the shifts
+     * are less than the width of bi_buf.
      */
-    if (s->bi_valid > (int)Buf_size - length) {
-        s->bi_buf |= (ush)value << s->bi_valid;
-        put_short(s, s->bi_buf);
-        s->bi_buf = (ush)value >> (Buf_size - s->bi_valid);
+    if (s->bi_valid >= Buf_size - length) {
+        s->bi_buf |= value << s->bi_valid;
+        put_word(s, s->bi_buf);
+        s->bi_buf = value >> (Buf_size - s->bi_valid);
         s->bi_valid += length - Buf_size;
     } else {
-        s->bi_buf |= (ush)value << s->bi_valid;
+        s->bi_buf |= value << s->bi_valid;
         s->bi_valid += length;
     }
 }
@@ -212,29 +255,77 @@ local void send_bits(s, value, length)
 
 #define send_bits(s, value, length) \
 { int len = length;\
-  if (s->bi_valid > (int)Buf_size - len) {\
-    int val = value;\
-    s->bi_buf |= (ush)val << s->bi_valid;\
-    put_short(s, s->bi_buf);\
-    s->bi_buf = (ush)val >> (Buf_size - s->bi_valid);\
+  bi_word val = (bi_word)(value);\
+  if (s->bi_valid >= Buf_size - len) {\
+    s->bi_buf |= val << s->bi_valid;\
+    put_word(s, s->bi_buf);\
+    s->bi_buf = val >> (Buf_size - s->bi_valid);\
     s->bi_valid += len - Buf_size;\
   } else {\
-    s->bi_buf |= (ush)(value) << s->bi_valid;\
+    s->bi_buf |= val << s->bi_valid;\
     s->bi_valid += len;\
   }\
 }
 #endif /* DEBUG */
 
+/* ===========================================================================
+ * Send a match with the given trees: lc is the match length - MIN_MATCH, and
+ * dist the match distance - 1.  With a 64-bit bit buffer, the length code,
+ * the distance code, and their extra bits, 48 bits at most, are put together
+ * and sent at once.  An extra bits field of zero length adds nothing, since
+ * lc or dist is then the base value of its code.  The arguments must not have
+ * side effects.
+ */
+#if Buf_size == 64
+#  define send_match(s, ltree, dtree, lc, dist) \
+{ unsigned lcode = _length_code[lc];\
+  unsigned dcode = d_code(dist);\
+  bi_word mbits = ltree[lcode+LITERALS+1].Code;\
+  int mlen = ltree[lcode+LITERALS+1].Len;\
+  mbits |= (bi_word)((lc) - base_length[lcode]) << mlen;\
+  mlen += extra_lbits[lcode];\
+  mbits |= (bi_word)dtree[dcode].Code << mlen;\
+  mlen += dtree[dcode].Len;\
+  mbits |= (bi_word)((dist) - base_dist[dcode]) << mlen;\
+  mlen += extra_dbits[dcode];\
+  send_bits(s, mbits, mlen);\
+}
+#else
+#  define send_match(s, ltree, dtree, lc, dist) \
+{ unsigned code = _length_code[lc];\
+  int extra;\
+  send_code(s, code+LITERALS+1, ltree);\
+  extra = extra_lbits[code];\
+  if (extra != 0)\
+    send_bits(s, (lc) - base_length[code], extra);\
+  code = d_code(dist);\
+  send_code(s, code, dtree);\
+  extra = extra_dbits[code];\
+  if (extra != 0)\
+    send_bits(s, (dist) - base_dist[code], extra);\
+}
+#endif
+
 
 /* the arguments must not have side effects */
 
 /* ===========================================================================
- * Initialize the various 'constant' tables.
+ * Initialize the various 'constant' tables, if they are not compiled in.  This
+ * is safe to call from several threads at once.
  */
 local void tr_static_init()
 {
 #if defined(GEN_TREES_H) || !defined(STDC)
-    static int static_init_done = 0;
+    Z_ONCE(&static_init_done, tr_static_make);
+#endif
+}
+
+#if defined(GEN_TREES_H) || !defined(STDC)
+/* ===========================================================================
+ * Make the 'constant' tables.  This is only called once, through Z_ONCE().
+ */
+local void tr_static_make()
+{
     int n;        /* iterates over tree elements */
     int bits;     /* bit counter */
     int length;   /* length value */
@@ -243,8 +334,6 @@ local void tr_static_init()
     ush bl_count[MAX_BITS+1];
     /* number of codes at each bit length for an optimal tree */
 
-    if (static_init_done) return;
-
     /* For some embedded targets, global variables are not initialized: */
 #ifdef NO_INIT_GLOBAL_POINTERS
     static_l_desc.static_tree = static_ltree;
@@ -265,9 +354,11 @@ local void tr_static_init()
     Assert (length == 256, "tr_static_init: length != 256");
     /* Note that the length 255 (match length 258) can be represented
      * in two different ways: code 284 + 5 bits or code 285, so we
-     * overwrite length_code[255] to use the best encoding:
+     * overwrite length_code[255] to use the best encoding.  Code 285 has no
+     * extra bits, so its base is 255, which send_match() relies on:
      */
     _length_code[length-1] = (uch)code;
+    base_length[code] = length-1;
 
     /* Initialize the mapping dist (0..32K) -> dist code (0..29) */
     dist = 0;
@@ -305,13 +396,12 @@ local void tr_static_init()
         static_dtree[n].Len = 5;
         static_dtree[n].Code = bi_reverse((unsigned)n, 5);
     }
-    static_init_done = 1;
 
 #  ifdef GEN_TREES_H
     gen_trees_header();
 #  endif
-#endif /* defined(GEN_TREES_H) || !defined(STDC) */
 }
+#endif /* defined(GEN_TREES_H) || !defined(STDC) */
 
 /* ===========================================================================
  * Genererate the file trees.h describing the static trees.
@@ -419,6 +509,10 @@ local void init_block(s)
     s->dyn_ltree[END_BLOCK].Freq = 1;
     s->opt_len = s->static_len = 0L;
     s->last_lit = s->matches = 0;
+
+    for (n = 0; n < SPLIT_TYPES; n++) s->split_count[n] = 0;
+    s->split_lit = s->lit_bufsize - 1 < SPLIT_SYMS ?
+                   s->lit_bufsize - 1 : SPLIT_SYMS;
 }
 
 #define SMALLEST 1
@@ -475,6 +569,53 @@ local void pqdownheap(s, tree, k)
     s->heap[k] = v;
 }
 
+/* ===========================================================================
+ * Construct the Huffman tree for the few leaves in heap[1..heap_len] without
+ * the heap: sort the leaves by frequency, then repeatedly combine the two
+ * least frequent of the leaves and nodes left.  The nodes are made in order
+ * of increasing frequency, so they need no sorting.  A leaf is taken before
+ * a node of equal frequency, as the depth tie breaker of smaller() does.  The
+ * nodes are left in heap[heap_max..] as build_tree() leaves them.
+ */
+#define SORT_LEAVES 128
+/* Most leaves for which sorting is faster than the heap */
+
+local void sort_tree(s, tree, elems)
+    deflate_state *s;
+    ct_data *tree;  /* the tree to construct */
+    int elems;      /* first internal node of the tree */
+{
+    int *heap = s->heap;
+    int leaves = s->heap_len;
+    int leaf = 1;       /* least frequent leaf left */
+    int next = elems;   /* least frequent node left */
+    int node = elems;   /* next internal node of the tree */
+    int i, j, n, m;
+    ush f;
+
+    for (i = 2; i <= leaves; i++) {
+        n = heap[i];
+        f = tree[n].Freq;
+        for (j = i; j > 1 && tree[heap[j-1]].Freq > f; j--)
+            heap[j] = heap[j-1];
+        heap[j] = n;
+    }
+    do {
+        n = leaf <= leaves && (next == node ||
+                               tree[heap[leaf]].Freq <= tree[next].Freq) ?
+            heap[leaf++] : next++;
+        m = leaf <= leaves && (next == node ||
+                               tree[heap[leaf]].Freq <= tree[next].Freq) ?
+            heap[leaf++] : next++;
+        heap[--(s->heap_max)] = n;
+        heap[--(s->heap_max)] = m;
+        tree[node].Freq = tree[n].Freq + tree[m].Freq;
+        tree[n].Dad = tree[m].Dad = (ush)node;
+        node++;
+    } while (leaf <= leaves || node - next > 1);
+    heap[--(s->heap_max)] = next;
+}
+
 /* ===========================================================================
  * Compute the optimal bit lengths for a tree and update the total bit length
  * for the current block.
@@ -654,40 +795,45 @@ local void build_tree(s, desc)
     }
     desc->max_code = max_code;
 
-    /* The elements heap[heap_len/2+1 .. heap_len] are leaves of the tree,
-     * establish sub-heaps of increasing lengths:
-     */
-    for (n = s->heap_len/2; n >= 1; n--) pqdownheap(s, tree, n);
-
-    /* Construct the Huffman tree by repeatedly combining the least two
-     * frequent nodes.
-     */
-    node = elems;              /* next internal node of the tree */
-    do {
-        pqremove(s, tree, n);  /* n = node of least frequency */
-        m = s->heap[SMALLEST]; /* m = node of next least frequency */
-
-        s->heap[--(s->heap_max)] = n; /* keep the nodes sorted by frequency */
-        s->heap[--(s->heap_max)] = m;
+    if (s->heap_len <= SORT_LEAVES) {
+        sort_tree(s, tree, elems);
+    } else {
+        /* The elements heap[heap_len/2+1 .. heap_len] are leaves of the tree,
+         * establish sub-heaps of increasing lengths:
+         */
+        for (n = s->heap_len/2; n >= 1; n--) pqdownheap(s, tree, n);
 
-        /* Create a new node father of n and m */
-        tree[node].Freq = tree[n].Freq + tree[m].Freq;
-        s->depth[node] = (uch)((s->depth[n] >= s->depth[m] ?
-                                s->depth[n] : s->depth[m]) + 1);
-        tree[n].Dad = tree[m].Dad = (ush)node;
+        /* Construct the Huffman tree by repeatedly combining the least two
+         * frequent nodes.
+         */
+        node = elems;              /* next internal node of the tree */
+        do {
+            pqremove(s, tree, n);  /* n = node of least frequency */
+            m = s->heap[SMALLEST]; /* m = node of next least frequency */
+
+            /* keep the nodes sorted by frequency */
+            s->heap[--(s->heap_max)] = n;
+            s->heap[--(s->heap_max)] = m;
+
+            /* Create a new node father of n and m */
+            tree[node].Freq = tree[n].Freq + tree[m].Freq;
+            s->depth[node] = (uch)((s->depth[n] >= s->depth[m] ?
+                                    s->depth[n] : s->depth[m]) + 1);
+            tree[n].Dad = tree[m].Dad = (ush)node;
 #ifdef DUMP_BL_TREE
-        if (tree == s->bl_tree) {
-            fprintf(stderr,"\nnode %d(%d), sons %d(%d) %d(%d)",
-                    node, tree[node].Freq, n, tree[n].Freq, m, tree[m].Freq);
-        }
+            if (tree == s->bl_tree) {
+                fprintf(stderr,"\nnode %d(%d), sons %d(%d) %d(%d)", node,
+                        tree[node].Freq, n, tree[n].Freq, m, tree[m].Freq);
+            }
 #endif
-        /* and insert the new node in the heap */
-        s->heap[SMALLEST] = node++;
-        pqdownheap(s, tree, SMALLEST);
+            /* and insert the new node in the heap */
+            s->heap[SMALLEST] = node++;
+            pqdownheap(s, tree, SMALLEST);
 
-    } while (s->heap_len >= 2);
+        } while (s->heap_len >= 2);
 
-    s->heap[--(s->heap_max)] = s->heap[SMALLEST];
+        s->heap[--(s->heap_max)] = s->heap[SMALLEST];
+    }
 
     /* At this point, the fields freq and dad are set. We can now
      * generate the bit lengths.
@@ -900,9 +1046,154 @@ void ZLIB_INTERNAL _tr_align(s)
     bi_flush(s);
 }
 
+/* ===========================================================================
+ * Send a block with the static trees directly, for deflate_quick(), instead of
+ * tallying its symbols: _tr_quick_start() sends the block type, each literal
+ * or match is sent as it is found, and _tr_quick_end() sends the end of block
+ * code.  Each call sends at most 48 bits.
+ */
+void ZLIB_INTERNAL _tr_quick_start(s, last)
+    deflate_state *s;
+    int last;         /* one if this is the last block for a file */
+{
+    send_bits(s, (STATIC_TREES<<1)+last, 3);
+}
+
+void ZLIB_INTERNAL _tr_quick_lit(s, c)
+    deflate_state *s;
+    unsigned c;       /* the literal byte */
+{
+    send_code(s, c, static_ltree);
+    Tracecv(isgraph(c), (stderr," '%c' ", c));
+}
+
+void ZLIB_INTERNAL _tr_quick_dist(s, dist, lc)
+    deflate_state *s;
+    unsigned dist;    /* distance of matched string */
+    unsigned lc;      /* match length-MIN_MATCH */
+{
+    dist--;
+    Assert (d_code(dist) < D_CODES, "bad d_code");
+    send_match(s, static_ltree, static_dtree, lc, dist);
+}
+
+void ZLIB_INTERNAL _tr_quick_end(s, last)
+    deflate_state *s;
+    int last;         /* one if this is the last block for a file */
+{
+    send_code(s, END_BLOCK, static_ltree);
+    if (last)
+        bi_windup(s);
+#ifdef DEBUG
+    s->compressed_len = s->bits_sent;
+#endif
+}
+
+/* ===========================================================================
+ * Return the number of bits that a block with the literal and length counts
+ * lfreq[] and the distance counts dfreq[] would take with the better of the
+ * dynamic and the static trees, counting the block header and the tree
+ * representation as _tr_flush_block() does.  The end of block code is counted
+ * once whatever lfreq[END_BLOCK] is.  If lcost is not null, the bits
+ * for each literal or length code and for each distance code, extra bits
+ * included, are written to lcost[] and dcost[].  A code with a zero count is
+ * given one bit more than the longest code.  The trees and the counts of the
+ * current block are left as they were, so this can be used by
+ * deflate_optimal() between any two calls of _tr_tally().
+ */
+ulg ZLIB_INTERNAL _tr_cost(s, lfreq, dfreq, lcost, dcost)
+    deflate_state *s;
+    const unsigned *lfreq;  /* literal and length code counts */
+    const unsigned *dfreq;  /* distance code counts */
+    uch *lcost;             /* bits for each literal and length code, or null */
+    uch *dcost;             /* bits for each distance code, or null */
+{
+    ush lsave[L_CODES], dsave[D_CODES];
+    ulg opt_len = s->opt_len, static_len = s->static_len;
+    int lmax = s->l_desc.max_code, dmax = s->d_desc.max_code;
+    int blmax = s->bl_desc.max_code;
+    ulg total = 0, dyn, stat;
+    int n, shift, longest;
+
+    /* Keep the sums of the counts in the internal nodes within a ush */
+    for (n = 0; n < L_CODES; n++)
+        total += lfreq[n];
+    for (n = 0; n < D_CODES; n++)
+        total += dfreq[n];
+    for (shift = 0; (total >> shift) > 0xffff - L_CODES - D_CODES; shift++)
+        ;
+
+    for (n = 0; n < L_CODES; n++) {
+        lsave[n] = s->dyn_ltree[n].Freq;
+        s->dyn_ltree[n].Freq = (ush)(lfreq[n] == 0 ? 0 :
+                                     lfreq[n] >> shift == 0 ? 1 :
+                                     lfreq[n] >> shift);
+    }
+    s->dyn_ltree[END_BLOCK].Freq = 1;
+    for (n = 0; n < D_CODES; n++) {
+        dsave[n] = s->dyn_dtree[n].Freq;
+        s->dyn_dtree[n].Freq = (ush)(dfreq[n] == 0 ? 0 :
+                                     dfreq[n] >> shift == 0 ? 1 :
+                                     dfreq[n] >> shift);
+    }
+
+    s->opt_len = s->static_len = 0L;
+    build_tree(s, (tree_desc *)(&(s->l_desc)));
+    build_tree(s, (tree_desc *)(&(s->d_desc)));
+
+    if (lcost != Z_NULL) {
+        if (s->strategy == Z_FIXED) {
+            for (n = 0; n < L_CODES; n++)
+                lcost[n] = (uch)static_ltree[n].Len;
+            for (n = 0; n < D_CODES; n++)
+                dcost[n] = (uch)static_dtree[n].Len;
+        } else {
+            longest = 0;
+            for (n = 0; n < L_CODES; n++)
+                if (s->dyn_ltree[n].Len > longest)
+                    longest = s->dyn_ltree[n].Len;
+            for (n = 0; n < L_CODES; n++)
+                lcost[n] = (uch)(s->dyn_ltree[n].Len != 0 ?
+                                 s->dyn_ltree[n].Len : longest + 1);
+            longest = 0;
+            for (n = 0; n < D_CODES; n++)
+                if (s->dyn_dtree[n].Len > longest)
+                    longest = s->dyn_dtree[n].Len;
+            for (n = 0; n < D_CODES; n++)
+                dcost[n] = (uch)(s->dyn_dtree[n].Len != 0 ?
+                                 s->dyn_dtree[n].Len : longest + 1);
+        }
+        for (n = 0; n < LENGTH_CODES; n++)
+            lcost[LITERALS+1+n] += (uch)extra_lbits[n];
+        for (n = 0; n < D_CODES; n++)
+            dcost[n] += (uch)extra_dbits[n];
+    }
+
+    /* Add the tree representation, then put back what was there */
+    build_bl_tree(s);
+    dyn = (s->opt_len + 3) << shift;
+    stat = (s->static_len + 3) << shift;
+
+    for (n = 0; n < L_CODES; n++)
+        s->dyn_ltree[n].Freq = lsave[n];
+    for (n = 0; n < D_CODES; n++)
+        s->dyn_dtree[n].Freq = dsave[n];
+    for (n = 0; n < BL_CODES; n++)
+        s->bl_tree[n].Freq = 0;
+    s->opt_len = opt_len, s->static_len = static_len;
+    s->l_desc.max_code = lmax, s->d_desc.max_code = dmax;
+    s->bl_desc.max_code = blmax;
+
+    if (s->strategy == Z_FIXED || stat < dyn)
+        return stat;
+    return dyn;
+}
+
 /* ===========================================================================
  * Determine the best encoding for the current block: dynamic trees, static
- * trees or store, and output the encoded block to the zip file.
+ * trees or store, and output the encoded block to the zip file.  With
+ * Z_HUFFMAN_ONLY, the block was tallied by _tr_tally_lits(), and its literals
+ * are the bytes at buf.
  */
 void ZLIB_INTERNAL _tr_flush_block(s, buf, stored_len, last)
     deflate_state *s;
@@ -966,26 +1257,46 @@ void ZLIB_INTERNAL _tr_flush_block(s, buf, stored_len, last)
          */
         _tr_stored_block(s, buf, stored_len, last);
 
+        /* A full block that did not compress at all is likely followed by
+         * more of the same: have deflate() store the input from here on
+         * until it looks compressible again.
+         */
+        s->raw = s->level > 0 && stored_len >= s->lit_bufsize - 1;
+
 #ifdef FORCE_STATIC
     } else if (static_lenb >= 0) { /* force static trees */
 #else
     } else if (s->strategy == Z_FIXED || static_lenb == opt_lenb) {
 #endif
         send_bits(s, (STATIC_TREES<<1)+last, 3);
-        compress_block(s, (const ct_data *)static_ltree,
-                       (const ct_data *)static_dtree);
+        if (s->strategy == Z_HUFFMAN_ONLY)
+            compress_lits(s, (const ct_data *)static_ltree, (const uch *)buf,
+                          stored_len);
+        else
+            compress_block(s, (const ct_data *)static_ltree,
+                           (const ct_data *)static_dtree);
 #ifdef DEBUG
         s->compressed_len += 3 + s->static_len;
 #endif
+        s->raw = 0;
     } else {
         send_bits(s, (DYN_TREES<<1)+last, 3);
         send_all_trees(s, s->l_desc.max_code+1, s->d_desc.max_code+1,
                        max_blindex+1);
-        compress_block(s, (const ct_data *)s->dyn_ltree,
-                       (const ct_data *)s->dyn_dtree);
+        /* Clear the guards that scan_tree() left after the last codes, since
+           compress_block() reads the lengths of all of the codes. */
+        s->dyn_ltree[s->l_desc.max_code+1].Len = 0;
+        s->dyn_dtree[s->d_desc.max_code+1].Len = 0;
+        if (s->strategy == Z_HUFFMAN_ONLY)
+            compress_lits(s, (const ct_data *)s->dyn_ltree, (const uch *)buf,
+                          stored_len);
+        else
+            compress_block(s, (const ct_data *)s->dyn_ltree,
+                           (const ct_data *)s->dyn_dtree);
 #ifdef DEBUG
         s->compressed_len += 3 + s->opt_len;
 #endif
+        s->raw = 0;
     }
     Assert (s->compressed_len == s->bits_sent, "bad compressed size");
     /* The above check is made mod 2^32, for files larger than 512 MB
@@ -1047,15 +1358,165 @@ int ZLIB_INTERNAL _tr_tally (s, dist, lc)
         if (s->matches < s->last_lit/2 && out_length < in_length/2) return 1;
     }
 #endif
-    return (s->last_lit == s->lit_bufsize-1);
+    return (s->last_lit == s->split_lit && _tr_split(s));
     /* We avoid equality with lit_bufsize because of wraparound at 64K
      * on 16 bit machines and because stored blocks are restricted to
      * 64K-1 bytes.
      */
 }
 
+/* ===========================================================================
+ * Called by _tr_tally() when last_lit reaches split_lit: return true if the
+ * current block must be flushed, because the symbol buffer is full or because
+ * the last SPLIT_SYMS symbols differ enough from the ones before them in the
+ * block that new trees are likely to pay for themselves.  The symbols are put
+ * in a few kinds: literals by their top two bits and their low bit, and short
+ * and long matches.  The difference is the sum over the kinds of how far the
+ * share of each in the last symbols is from its share before, and less of it
+ * is needed as the block grows longer.  This is done at all levels that use
+ * dynamic trees, except by deflate_optimal(), which prices its blocks.
+ */
+int ZLIB_INTERNAL _tr_split(s)
+    deflate_state *s;
+{
+    unsigned count[SPLIT_TYPES]; /* kinds of the last SPLIT_SYMS symbols */
+    uInt lx;            /* index in l_buf */
+    int n;
+
+    if (s->last_lit >= s->lit_bufsize - 1)
+        return 1;
+    s->split_lit = s->lit_bufsize - 1;
+    if (s->level > Z_BEST_COMPRESSION || s->strategy == Z_FIXED)
+        return 0;
+
+    for (n = 0; n < SPLIT_TYPES; n++) count[n] = 0;
+    for (lx = s->last_lit - SPLIT_SYMS; lx < s->last_lit; lx++) {
+        n = s->l_buf[lx];
+        if (s->d_buf[lx] == 0)
+            count[((n >> 5) & 6) | (n & 1)]++;
+        else
+            count[n < 9 - MIN_MATCH ? 8 : 9]++;
+    }
+    return split_end(s, count, (ulg)((long)s->strstart - s->block_start));
+}
+
+/* ===========================================================================
+ * Return true if the block must end at last_lit, given the kinds of the last
+ * SPLIT_SYMS symbols in count, and the number of input bytes the block covers.
+ * Otherwise add count to the kinds of the symbols before, and set split_lit
+ * to where to look next.
+ */
+local int split_end(s, count, bytes)
+    deflate_state *s;
+    const unsigned *count;  /* kinds of the last SPLIT_SYMS symbols */
+    ulg bytes;              /* input bytes covered by the block */
+{
+    ulg before;         /* number of symbols before those */
+    ulg diff;           /* total difference, scaled by before*SPLIT_SYMS */
+    ulg a, b;
+    int n;
+
+    before = s->last_lit - SPLIT_SYMS;
+    if (before != 0 && bytes >= SPLIT_MIN_BYTES) {
+        diff = 0;
+        for (n = 0; n < SPLIT_TYPES; n++) {
+            a = count[n] * before;
+            b = s->split_count[n] * (ulg)SPLIT_SYMS;
+            diff += a > b ? a - b : b - a;
+        }
+        if (diff + (bytes >> 12) * before >= before * (SPLIT_SYMS*200/512)) {
+            Tracev((stderr, "\nsplit at %u symbols, %lu bytes",
+                    s->last_lit, bytes));
+            return 1;
+        }
+    }
+
+    for (n = 0; n < SPLIT_TYPES; n++) s->split_count[n] += count[n];
+    if (s->last_lit + SPLIT_SYMS < s->lit_bufsize - 1)
+        s->split_lit = s->last_lit + SPLIT_SYMS;
+    return 0;
+}
+
+/* ===========================================================================
+ * Tally as literals the bytes at buf for a block of deflate_huff(), up to len
+ * of them, and return how many were taken before the block must end.  The
+ * block must be empty, save for bytes that deflate_huff() gathered in l_buf
+ * and counted in last_lit, and len less than lit_bufsize.  The literals are
+ * not saved: _tr_flush_block() sends them from its input block, which must
+ * be these bytes.  They are counted in four tables in turn, so that a
+ * run of one byte value does not wait on a single counter for each byte.  At
+ * each split_lit, the kinds of the last SPLIT_SYMS literals are found from the
+ * counts, and the block ends where _tr_split() would end it.
+ */
+uInt ZLIB_INTERNAL _tr_tally_lits(s, buf, len)
+    deflate_state *s;
+    const Bytef *buf;
+    uInt len;
+{
+    ush freq[4][LITERALS];      /* counts of the bytes, in four tables */
+    unsigned count[SPLIT_TYPES]; /* kinds of the last SPLIT_SYMS bytes */
+    const Bytef *next, *end;
+    uInt last;                  /* bytes tallied when this piece is done */
+    int n;
+
+    Assert(s->matches == 0 && len < s->lit_bufsize, "bad literal block");
+    zmemzero((Bytef *)freq, sizeof(freq));
+    s->last_lit = 0;
+    for (;;) {
+        last = s->split_lit < len ? s->split_lit : len;
+        next = buf + s->last_lit;
+        end = buf + last;
+        while (end - next >= 4) {
+            freq[0][next[0]]++;
+            freq[1][next[1]]++;
+            freq[2][next[2]]++;
+            freq[3][next[3]]++;
+            next += 4;
+        }
+        while (next < end)
+            freq[0][*next++]++;
+        s->last_lit = last;
+        if (last != s->split_lit || last >= s->lit_bufsize - 1)
+            break;
+        s->split_lit = s->lit_bufsize - 1;
+        if (s->level > Z_BEST_COMPRESSION)
+            continue;
+
+        /* No need for the kinds until the block could be split at the next
+         * split_lit.  split_count then has the kinds of all of the bytes up
+         * to this split_lit, since there are no matches.
+         */
+        if (last + SPLIT_SYMS < SPLIT_MIN_BYTES) {
+            if (last + SPLIT_SYMS < s->lit_bufsize - 1)
+                s->split_lit = last + SPLIT_SYMS;
+            continue;
+        }
+        for (n = 0; n < SPLIT_TYPES; n++) count[n] = 0 - s->split_count[n];
+        for (n = 0; n < LITERALS; n++)
+            count[((n >> 5) & 6) | (n & 1)] +=
+                freq[0][n] + freq[1][n] + freq[2][n] + freq[3][n];
+        if (split_end(s, count, (ulg)last))
+            break;
+    }
+
+    for (n = 0; n < LITERALS; n++)
+        s->dyn_ltree[n].Freq = freq[0][n] + freq[1][n] + freq[2][n] +
+                               freq[3][n];
+    return s->last_lit;
+}
+
 /* ===========================================================================
  * Send the block data compressed using the given Huffman trees
+ *
+ * With a 64-bit bit buffer, the codes for the block are first fused into
+ * tables, so that a match costs a few lookups and a single send_bits().
+ * lenc[lc] has the length code for lc and its extra bits, above five bits
+ * with their total bit count.  The extra bits of a distance depend on the
+ * distance, but the code for a distance is (dist - base) << len | code,
+ * where len is the bit length of the code.  Since the code is less than
+ * 1 << len, that is the same as (dist << len) + (code - (base << len)), so
+ * doff[] has the second term for each distance code, computed modulo the
+ * width of bi_word.
  */
 local void compress_block(s, ltree, dtree)
     deflate_state *s;
@@ -1063,10 +1524,38 @@ local void compress_block(s, ltree, dtree)
     const ct_data *dtree; /* distance tree */
 {
     unsigned dist;      /* distance of matched string */
-    int lc;             /* match length or unmatched char (if dist == 0) */
+    unsigned lc;        /* match length or unmatched char (if dist == 0) */
     unsigned lx = 0;    /* running index in l_buf */
-    unsigned code;      /* the code to send */
-    int extra;          /* number of extra bits to send */
+#if Buf_size == 64
+    ulg lenc[MAX_MATCH-MIN_MATCH+1];    /* fused length codes */
+    bi_word doff[D_CODES];  /* distance code less base distance << code bits */
+    uch dbits[D_CODES];     /* bit length of each distance code */
+    uch dlen[D_CODES];      /* bits of each distance code and its extra bits */
+    unsigned code;          /* length or distance code */
+    bi_word mbits;          /* the bits of a match */
+    int mlen;               /* the number of bits of the match */
+    int fused;              /* true to use the tables above for matches */
+
+    /* Making the tables costs about as much as sending that many matches
+     * with send_match(), so a block with few matches goes without them.
+     */
+    fused = s->matches > MAX_MATCH-MIN_MATCH;
+    if (fused) {
+        for (lc = 0; lc <= MAX_MATCH-MIN_MATCH; lc++) {
+            code = _length_code[lc];
+            mlen = ltree[code+LITERALS+1].Len;
+            lenc[lc] = ((ltree[code+LITERALS+1].Code |
+                         (ulg)(lc - base_length[code]) << mlen) << 5) |
+                       (mlen + extra_lbits[code]);
+        }
+        for (code = 0; code < D_CODES; code++) {
+            dbits[code] = (uch)dtree[code].Len;
+            dlen[code] = (uch)(dtree[code].Len + extra_dbits[code]);
+            doff[code] = dtree[code].Code -
+                         ((bi_word)base_dist[code] << dtree[code].Len);
+        }
+    }
+#endif
 
     if (s->last_lit != 0) do {
         dist = s->d_buf[lx];
@@ -1076,23 +1565,24 @@ local void compress_block(s, ltree, dtree)
             Tracecv(isgraph(lc), (stderr," '%c' ", lc));
         } else {
             /* Here, lc is the match length - MIN_MATCH */
-            code = _length_code[lc];
-            send_code(s, code+LITERALS+1, ltree); /* send the length code */
-            extra = extra_lbits[code];
-            if (extra != 0) {
-                lc -= base_length[code];
-                send_bits(s, lc, extra);       /* send the extra length bits */
-            }
             dist--; /* dist is now the match distance - 1 */
-            code = d_code(dist);
-            Assert (code < D_CODES, "bad d_code");
-
-            send_code(s, code, dtree);       /* send the distance code */
-            extra = extra_dbits[code];
-            if (extra != 0) {
-                dist -= base_dist[code];
-                send_bits(s, dist, extra);   /* send the extra distance bits */
+#if Buf_size == 64
+            if (fused) {
+                code = d_code(dist);
+                Assert (code < D_CODES, "bad d_code");
+                mlen = (int)(lenc[lc] & 31);
+                mbits = (lenc[lc] >> 5) |
+                        (((bi_word)dist << dbits[code]) + doff[code]) << mlen;
+                mlen += dlen[code];
+                send_bits(s, mbits, mlen);
+            } else {
+                Assert (d_code(dist) < D_CODES, "bad d_code");
+                send_match(s, ltree, dtree, lc, dist);
             }
+#else
+            Assert (d_code(dist) < D_CODES, "bad d_code");
+            send_match(s, ltree, dtree, lc, dist);
+#endif
         } /* literal or match pair ? */
 
         /* Check that the overlay between pending_buf and d_buf+l_buf is ok: */
@@ -1104,6 +1594,39 @@ local void compress_block(s, ltree, dtree)
     send_code(s, END_BLOCK, ltree);
 }
 
+/* ===========================================================================
+ * Send the literals of a block of deflate_huff(), which are the len bytes at
+ * buf, using the given literal tree.  With a 64-bit bit buffer, the codes of
+ * four literals, 60 bits at most, are put together and sent at once.
+ */
+local void compress_lits(s, ltree, buf, len)
+    deflate_state *s;
+    const ct_data *ltree; /* literal tree */
+    const uch *buf;       /* the literals */
+    ulg len;              /* number of literals */
+{
+    ulg n = 0;          /* index in buf */
+#if Buf_size == 64
+    bi_word bits;       /* the codes of four literals */
+    int blen;           /* the number of bits of those */
+
+    for (; n + 4 <= len; n += 4) {
+        bits = ltree[buf[n]].Code;
+        blen = ltree[buf[n]].Len;
+        bits |= (bi_word)ltree[buf[n + 1]].Code << blen;
+        blen += ltree[buf[n + 1]].Len;
+        bits |= (bi_word)ltree[buf[n + 2]].Code << blen;
+        blen += ltree[buf[n + 2]].Len;
+        bits |= (bi_word)ltree[buf[n + 3]].Code << blen;
+        blen += ltree[buf[n + 3]].Len;
+        send_bits(s, bits, blen);
+    }
+#endif
+    for (; n < len; n++)
+        send_code(s, buf[n], ltree);
+    send_code(s, END_BLOCK, ltree);
+}
+
 /* ===========================================================================
  * Check if the data type is TEXT or BINARY, using the following algorithm:
  * - TEXT if the two conditions below are satisfied:
@@ -1147,20 +1670,20 @@ local int detect_data_type(s)
 }
 
 /* ===========================================================================
- * Reverse the first len bits of a code, using straightforward code (a faster
- * method would use a table)
+ * Reverse the first len bits of a code, by swapping ever smaller halves of a
+ * 16-bit word instead of one bit at a time.  This is done for every code of
+ * every dynamic tree, which matters when blocks are small.
  * IN assertion: 1 <= len <= 15
  */
 local unsigned bi_reverse(code, len)
     unsigned code; /* the value to invert */
     int len;       /* its bit length */
 {
-    register unsigned res = 0;
-    do {
-        res |= code & 1;
-        code >>= 1, res <<= 1;
-    } while (--len > 0);
-    return res >> 1;
+    code = ((code & 0x00ff) << 8) | ((code >> 8) & 0x00ff);
+    code = ((code & 0x0f0f) << 4) | ((code >> 4) & 0x0f0f);
+    code = ((code & 0x3333) << 2) | ((code >> 2) & 0x3333);
+    code = ((code & 0x5555) << 1) | ((code >> 1) & 0x5555);
+    return code >> (16 - len);
 }
 
 /* ===========================================================================
@@ -1169,14 +1692,16 @@ local unsigned bi_reverse(code, len)
 local void bi_flush(s)
     deflate_state *s;
 {
-    if (s->bi_valid == 16) {
-        put_short(s, s->bi_buf);
+    if (s->bi_valid == Buf_size) {
+        put_word(s, s->bi_buf);
         s->bi_buf = 0;
         s->bi_valid = 0;
-    } else if (s->bi_valid >= 8) {
-        put_byte(s, (Byte)s->bi_buf);
-        s->bi_buf >>= 8;
-        s->bi_valid -= 8;
+    } else {
+        while (s->bi_valid >= 8) {
+            put_byte(s, (Byte)s->bi_buf);
+            s->bi_buf >>= 8;
+            s->bi_valid -= 8;
+        }
     }
 }
 
@@ -1186,10 +1711,10 @@ local void bi_flush(s)
 local void bi_windup(s)
     deflate_state *s;
 {
-    if (s->bi_valid > 8) {
-        put_short(s, s->bi_buf);
-    } else if (s->bi_valid > 0) {
+    while (s->bi_valid > 0) {
         put_byte(s, (Byte)s->bi_buf);
+        s->bi_buf >>= 8;
+        s->bi_valid -= 8;
     }
     s->bi_buf = 0;
     s->bi_valid = 0;
@@ -1220,7 +1745,8 @@ local void copy_block(s, buf, len, header)
 #ifdef DEBUG
     s->bits_sent += (ulg)len<<3;
 #endif
-    while (len--) {
-        put_byte(s, *buf++);
+    if (len) {
+        zmemcpy(s->pending_buf + s->pending, (Bytef *)buf, len);
+        s->pending += len;
     }
 }
@@ -21,28 +21,56 @@
 #  define _dist_code            z__dist_code
 #  define _length_code          z__length_code
 #  define _tr_align             z__tr_align
+#  define _tr_cost              z__tr_cost
 #  define _tr_flush_bits        z__tr_flush_bits
 #  define _tr_flush_block       z__tr_flush_block
 #  define _tr_init              z__tr_init
+#  define _tr_quick_dist        z__tr_quick_dist
+#  define _tr_quick_end         z__tr_quick_end
+#  define _tr_quick_lit         z__tr_quick_lit
+#  define _tr_quick_start       z__tr_quick_start
+#  define _tr_split             z__tr_split
 #  define _tr_stored_block      z__tr_stored_block
 #  define _tr_tally             z__tr_tally
+#  define _tr_tally_lits        z__tr_tally_lits
 #  define adler32               z_adler32
+#  define adler32_avx2          z_adler32_avx2
 #  define adler32_combine       z_adler32_combine
 #  define adler32_combine64     z_adler32_combine64
+#  define adler32_generic       z_adler32_generic
+#  define adler32_iov           z_adler32_iov
+#  define adler32_parallel      z_adler32_parallel
+#  define adler32_ssse3         z_adler32_ssse3
 #  ifndef Z_SOLO
 #    define compress              z_compress
 #    define compress2             z_compress2
 #    define compressBound         z_compressBound
 #  endif
+#  define copy_with_adler32     z_copy_with_adler32
+#  define copy_with_crc32       z_copy_with_crc32
 #  define crc32                 z_crc32
 #  define crc32_combine         z_crc32_combine
 #  define crc32_combine64       z_crc32_combine64
+#  define crc32_combine_gen     z_crc32_combine_gen
+#  define crc32_combine_gen64   z_crc32_combine_gen64
+#  define crc32_combine_op      z_crc32_combine_op
+#  define crc32_generic         z_crc32_generic
+#  define crc32_iov             z_crc32_iov
+#  define crc32_parallel        z_crc32_parallel
+#  define crc32_pclmul          z_crc32_pclmul
+#  define crc32c                z_crc32c
+#  define crc32c_combine        z_crc32c_combine
+#  define crc32c_combine64      z_crc32c_combine64
+#  define crc32c_generic        z_crc32c_generic
+#  define crc32c_sse42          z_crc32c_sse42
 #  define deflate               z_deflate
 #  define deflateBound          z_deflateBound
 #  define deflateCopy           z_deflateCopy
 #  define deflateEnd            z_deflateEnd
+#  define deflateHash           z_deflateHash
 #  define deflateInit2_         z_deflateInit2_
 #  define deflateInit_          z_deflateInit_
+#  define deflateInsertLimit    z_deflateInsertLimit
 #  define deflateParams         z_deflateParams
 #  define deflatePending        z_deflatePending
 #  define deflatePrime          z_deflatePrime
@@ -113,6 +141,12 @@
 #  define inflate_copyright     z_inflate_copyright
 #  define inflate_fast          z_inflate_fast
 #  define inflate_table         z_inflate_table
+#  define longest_match         z_longest_match
+#  define longest_match_avx2    z_longest_match_avx2
+#  define longest_match_sse2    z_longest_match_sse2
+#  define slide_hash_avx2       z_slide_hash_avx2
+#  define slide_hash_generic    z_slide_hash_generic
+#  define slide_hash_sse2       z_slide_hash_sse2
 #  ifndef Z_SOLO
 #    define uncompress            z_uncompress
 #  endif
@@ -238,6 +272,18 @@
 #  endif
 #endif
 
+/* Maximum value for memLevel in deflateInit2 with the levels above
+ * MAX_MEM_LEVEL.  Those only make the hash table larger, with 2^(memLevel+7)
+ * entries, while lit_bufsize stays capped at its size for MAX_MEM_LEVEL.
+ */
+#ifndef MAX_HASH_LEVEL
+#  if MAX_MEM_LEVEL == 9
+#    define MAX_HASH_LEVEL 13
+#  else
+#    define MAX_HASH_LEVEL MAX_MEM_LEVEL
+#  endif
+#endif
+
 /* Maximum value for windowBits in deflateInit2 and inflateInit2.
  * WARNING: reducing MAX_WBITS makes minigzip unable to extract .gz files
  * created by gzip. (Files created by minigzip can still be extracted by
@@ -250,8 +296,12 @@
 /* The memory requirements for deflate are (in bytes):
             (1 << (windowBits+2)) +  (1 << (memLevel+9))
  that is: 128K for windowBits=15  +  128K for memLevel = 8  (default values)
- plus a few kilobytes for small objects. For example, if you want to reduce
- the default memory requirements from 256K to 128K, compile with
+ plus a few kilobytes for small objects, and about 200K more for the optimal
+ parsing of compression levels 10 to 12. A memLevel above 9, up to
+ MAX_HASH_LEVEL, only makes the hash table larger, and then takes
+ (1 << (memLevel+8)) + 128K in place of (1 << (memLevel+9)), or 2M + 128K for
+ memLevel = 13. For example, if you want to reduce the default memory
+ requirements from 256K to 128K, compile with
      make CFLAGS="-O -DMAX_WBITS=14 -DMAX_MEM_LEVEL=7"
  Of course this will generally degrade compression (there's no free lunch).
 
@@ -408,6 +458,13 @@ typedef uLong FAR uLongf;
    typedef unsigned long z_crc_t;
 #endif
 
+#if defined(STDC) && !defined(Z_SOLO)
+#  include <stddef.h>           /* for size_t */
+   typedef size_t z_size_t;
+#else
+   typedef unsigned long z_size_t;
+#endif
+
 #ifdef HAVE_UNISTD_H    /* may be set to #if 1 by ./configure */
 #  define Z_HAVE_UNISTD_H
 #endif
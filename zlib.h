@@ -186,6 +186,7 @@ typedef gz_header FAR *gz_headerp;
 #define Z_NO_COMPRESSION         0
 #define Z_BEST_SPEED             1
 #define Z_BEST_COMPRESSION       9
+#define Z_OPTIMAL_COMPRESSION   12
 #define Z_DEFAULT_COMPRESSION  (-1)
 /* compression levels */
 
@@ -193,9 +194,14 @@ typedef gz_header FAR *gz_headerp;
 #define Z_HUFFMAN_ONLY        2
 #define Z_RLE                 3
 #define Z_FIXED               4
+#define Z_QUICK               5
 #define Z_DEFAULT_STRATEGY    0
 /* compression strategy; see deflateInit2() below for details */
 
+#define Z_HASH_ROLLING        0
+#define Z_HASH_FOUR           1
+/* hash functions for deflateHash() */
+
 #define Z_BINARY   0
 #define Z_TEXT     1
 #define Z_ASCII    Z_TEXT   /* for compatibility with 1.2.2 and earlier */
@@ -228,11 +234,14 @@ ZEXTERN int ZEXPORT deflateInit OF((z_streamp strm, int level));
    zalloc and zfree are set to Z_NULL, deflateInit updates them to use default
    allocation functions.
 
-     The compression level must be Z_DEFAULT_COMPRESSION, or between 0 and 9:
+     The compression level must be Z_DEFAULT_COMPRESSION, or between 0 and 12:
    1 gives best speed, 9 gives best compression, 0 gives no compression at all
    (the input data is simply copied a block at a time).  Z_DEFAULT_COMPRESSION
    requests a default compromise between speed and compression (currently
-   equivalent to level 6).
+   equivalent to level 6).  Levels 10 to 12 (Z_OPTIMAL_COMPRESSION) compress
+   better than level 9 by choosing the matches and block boundaries for the
+   fewest bits, but are many times slower and use about 200K more memory.  The
+   output is still standard deflate data.
 
      deflateInit returns Z_OK if success, Z_MEM_ERROR if there was not enough
    memory, Z_STREAM_ERROR if level is not a valid compression level, or
@@ -558,8 +567,12 @@ ZEXTERN int ZEXPORT deflateInit2 OF((z_streamp strm,
      The memLevel parameter specifies how much memory should be allocated
    for the internal compression state.  memLevel=1 uses minimum memory but is
    slow and reduces compression ratio; memLevel=9 uses maximum memory for
-   optimal speed.  The default value is 8.  See zconf.h for total memory usage
-   as a function of windowBits and memLevel.
+   optimal speed.  The default value is 8.  memLevel can also be 10 to 13 for
+   a hash table of 2^17 to 2^20 entries, up to 2M, in place of the 2^16 of
+   memLevel=9, so that fewer different strings share a hash chain.  Since the
+   window holds at most 32K strings, this gains little over memLevel=9 on
+   most data.  The output is standard deflate data as always.  See zconf.h
+   for total memory usage as a function of windowBits and memLevel.
 
      The strategy parameter is used to tune the compression algorithm.  Use the
    value Z_DEFAULT_STRATEGY for normal data, Z_FILTERED for data produced by a
@@ -574,7 +587,10 @@ ZEXTERN int ZEXPORT deflateInit2 OF((z_streamp strm,
    strategy parameter only affects the compression ratio but not the
    correctness of the compressed output even if it is not set appropriately.
    Z_FIXED prevents the use of dynamic Huffman codes, allowing for a simpler
-   decoder for special applications.
+   decoder for special applications.  Z_QUICK is faster than level 1 at the
+   cost of compression: it looks for a match only at the most recent string
+   with the same hash, and sends every block with the fixed codes.  Z_QUICK
+   overrides the level, and can expand incompressible data by up to one eighth.
 
      deflateInit2 returns Z_OK if success, Z_MEM_ERROR if there was not enough
    memory, Z_STREAM_ERROR if any parameter is invalid (such as an invalid
@@ -674,8 +690,11 @@ ZEXTERN int ZEXPORT deflateParams OF((z_streamp strm,
    compressed and flushed.  In particular, strm->avail_out must be non-zero.
 
      deflateParams returns Z_OK if success, Z_STREAM_ERROR if the source
-   stream state was inconsistent or if a parameter was invalid, Z_BUF_ERROR if
-   strm->avail_out was zero.
+   stream state was inconsistent or if a parameter was invalid, Z_MEM_ERROR if
+   there was not enough memory for a level above 9, Z_BUF_ERROR if
+   strm->avail_out was zero.  Z_BUF_ERROR is also returned, without changing
+   the parameters, if strm->avail_out was too small to complete the current
+   block.  deflateParams should then be called again with more output space.
 */
 
 ZEXTERN int ZEXPORT deflateTune OF((z_streamp strm,
@@ -695,6 +714,46 @@ ZEXTERN int ZEXPORT deflateTune OF((z_streamp strm,
    returns Z_OK on success, or Z_STREAM_ERROR for an invalid deflate stream.
  */
 
+ZEXTERN int ZEXPORT deflateHash OF((z_streamp strm,
+                                    int hash));
+/*
+     Select how deflate finds the earlier strings that the current string may
+   match.  Z_HASH_ROLLING, the default, puts strings that begin with the same
+   three bytes on one hash chain.  Z_HASH_FOUR uses the first four bytes, so
+   that the chains searched at compression levels 4 through 9 are shorter and
+   hold more useful matches, at the cost of missing some three-byte matches.
+   This helps most on data with many short repeated strings, such as logs and
+   JSON.  The compressed data differs from that with Z_HASH_ROLLING, but is the
+   same on all machines, and is decompressed by inflate as usual.
+
+     deflateHash() can be called after deflateInit(), deflateInit2(), or
+   deflateReset(), and before deflateSetDictionary() and the first call of
+   deflate().  The selection is kept by deflateReset() and deflateParams().
+   deflateHash returns Z_OK on success, or Z_STREAM_ERROR if the source stream
+   state was inconsistent, if hash is not valid, or if it was called too late.
+   Z_HASH_FOUR is not valid if zlib was built with ASMV, since the assembler
+   versions of the match search rely on the rolling hash.
+ */
+
+ZEXTERN int ZEXPORT deflateInsertLimit OF((z_streamp strm,
+                                           int limit));
+/*
+     Set the longest match whose strings are added to the hash table that
+   deflate searches for later matches.  The strings inside longer matches are
+   skipped, which saves time on very redundant data, such as repeated records,
+   but can miss some matches later on.  limit is from 0 to 258.  0, the
+   default, leaves this to the compression level: levels 1 through 3 skip the
+   strings inside matches longer than the max_lazy of deflateTune(), and
+   levels 4 through 9 add them all.  The limit does not apply to levels 10 to
+   12 or to the Z_QUICK, Z_HUFFMAN_ONLY, and Z_RLE strategies.
+
+     deflateInsertLimit() can be called at any time after deflateInit() or
+   deflateInit2(), and applies to the matches found from then on.  The limit
+   is kept by deflateReset() and deflateParams().  deflateInsertLimit returns
+   Z_OK on success, or Z_STREAM_ERROR if the source stream state was
+   inconsistent or if limit is out of range.
+ */
+
 ZEXTERN uLong ZEXPORT deflateBound OF((z_streamp strm,
                                        uLong sourceLen));
 /*
@@ -1306,8 +1365,10 @@ ZEXTERN int ZEXPORT gzsetparams OF((gzFile file, int level, int strategy));
      Dynamically update the compression level or strategy.  See the description
    of deflateInit2 for the meaning of these parameters.
 
-     gzsetparams returns Z_OK if success, or Z_STREAM_ERROR if the file was not
-   opened for writing.
+     gzsetparams returns Z_OK if success, Z_STREAM_ERROR if the file was not
+   opened for writing, or Z_MEM_ERROR if there was not enough memory for a
+   level above 9.  The level in the mode given to gzopen() can only be a single
+   digit, so gzsetparams() is the way to use levels 10 to 12 for a gzip file.
 */
 
 ZEXTERN int ZEXPORT gzread OF((gzFile file, voidp buf, unsigned len));
@@ -1621,7 +1682,92 @@ ZEXTERN uLong ZEXPORT crc32_combine OF((uLong crc1, uLong crc2, z_off_t len2));
    seq1 and seq2 with lengths len1 and len2, CRC-32 check values were
    calculated for each, crc1 and crc2.  crc32_combine() returns the CRC-32
    check value of seq1 and seq2 concatenated, requiring only crc1, crc2, and
-   len2.
+   len2.  This takes time proportional to the number of bits in len2, and
+   needs no memory beyond a few variables.
+*/
+
+/*
+ZEXTERN uLong ZEXPORT crc32_combine_gen OF((z_off_t len2));
+
+     Return the operator corresponding to length len2, to be used with
+   crc32_combine_op().  If len2 is not positive, the operator returned makes
+   crc32_combine_op() return crc1 ^ crc2.
+*/
+
+ZEXTERN uLong ZEXPORT crc32_combine_op OF((uLong crc1, uLong crc2, uLong op));
+/*
+     Give the same result as crc32_combine(), using op in place of len2.  op is
+   generated from len2 by crc32_combine_gen().  This will be faster than
+   crc32_combine() if the generated op is used more than once, for example
+   when many pieces of the same length are combined.
+*/
+
+ZEXTERN uLong ZEXPORT crc32c  OF((uLong crc, const Bytef *buf, uInt len));
+/*
+     Update a running CRC-32C with the bytes buf[0..len-1] and return the
+   updated CRC-32C.  This is the same as crc32(), but uses the Castagnoli
+   polynomial (0x1edc6f41, or 0x82f63b78 reflected) found in iSCSI, SCTP,
+   ext4, and many storage formats.  It has better error detection than the
+   CRC-32 polynomial, and is faster on x86 processors with SSE4.2.  The CRC-32C
+   of "123456789" is 0xe3069283.  If buf is Z_NULL, this function returns the
+   required initial value for the crc, which is zero.
+*/
+
+/*
+ZEXTERN uLong ZEXPORT crc32c_combine OF((uLong crc1, uLong crc2,
+                                         z_off_t len2));
+
+     Combine two CRC-32C check values into one, as crc32_combine() does for
+   CRC-32.
+*/
+
+typedef void (*z_work_func) OF((voidpf arg, unsigned index));
+typedef void (*z_run_func) OF((voidpf opaque, z_work_func work, voidpf arg,
+                               unsigned count));
+
+ZEXTERN uLong ZEXPORT crc32_parallel OF((uLong crc, const Bytef *buf,
+                                         z_size_t len, unsigned count,
+                                         z_run_func run, voidpf opaque));
+ZEXTERN uLong ZEXPORT adler32_parallel OF((uLong adler, const Bytef *buf,
+                                           z_size_t len, unsigned count,
+                                           z_run_func run, voidpf opaque));
+/*
+     Update a running CRC-32 or Adler-32 with the bytes buf[0..len-1], like
+   crc32() and adler32(), by splitting the buffer into as many as count pieces
+   that can be checked at the same time on different threads.  The check
+   values of the pieces are then merged as crc32_combine() and
+   adler32_combine() would.  The result is the same as that of crc32() or
+   adler32() on the whole buffer.
+
+     zlib does not create threads.  Instead, run(opaque, work, arg, count) is
+   called once, and must call work(arg, index) for each index from 0 to
+   count - 1, and return when all of those calls have returned.  The calls
+   may be made in any order, and from any threads, for example by handing
+   them to the application's thread pool and waiting for them.  The count
+   given to run() may be less than the count requested, since the pieces are
+   kept to at least a megabyte, and no more than 256 pieces are used.  If run
+   is Z_NULL, or if there is only one piece, the pieces are checked one after
+   another in the calling thread.  opaque is passed unchanged to run().
+*/
+
+typedef struct z_iovec_s {
+    voidpc base;                /* start of segment */
+    z_size_t len;               /* number of bytes in segment */
+} z_iovec;
+
+ZEXTERN uLong ZEXPORT crc32_iov OF((uLong crc, const z_iovec *iov,
+                                    unsigned count));
+ZEXTERN uLong ZEXPORT adler32_iov OF((uLong adler, const z_iovec *iov,
+                                      unsigned count));
+/*
+     Update a running CRC-32 or Adler-32 with the bytes of the count segments
+   iov[0..count-1], in order, as if they were one buffer.  Segments of any
+   length, including zero, are allowed.  Short segments are gathered into a
+   small buffer on the stack and checked together, which is much faster than
+   calling crc32() or adler32() on each of them.  Long segments are checked in
+   place.  z_iovec has the same layout as struct iovec on POSIX systems, so an
+   array of struct iovec can be passed here with a cast.  If iov is Z_NULL,
+   the required initial value for the check is returned.
 */
 
 
@@ -1695,6 +1841,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
    ZEXTERN z_off64_t ZEXPORT gzoffset64 OF((gzFile));
    ZEXTERN uLong ZEXPORT adler32_combine64 OF((uLong, uLong, z_off64_t));
    ZEXTERN uLong ZEXPORT crc32_combine64 OF((uLong, uLong, z_off64_t));
+   ZEXTERN uLong ZEXPORT crc32_combine_gen64 OF((z_off64_t));
+   ZEXTERN uLong ZEXPORT crc32c_combine64 OF((uLong, uLong, z_off64_t));
 #endif
 
 #if !defined(ZLIB_INTERNAL) && defined(Z_WANT64)
@@ -1705,6 +1853,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
 #    define z_gzoffset z_gzoffset64
 #    define z_adler32_combine z_adler32_combine64
 #    define z_crc32_combine z_crc32_combine64
+#    define z_crc32_combine_gen z_crc32_combine_gen64
+#    define z_crc32c_combine z_crc32c_combine64
 #  else
 #    define gzopen gzopen64
 #    define gzseek gzseek64
@@ -1712,6 +1862,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
 #    define gzoffset gzoffset64
 #    define adler32_combine adler32_combine64
 #    define crc32_combine crc32_combine64
+#    define crc32_combine_gen crc32_combine_gen64
+#    define crc32c_combine crc32c_combine64
 #  endif
 #  ifndef Z_LARGE64
      ZEXTERN gzFile ZEXPORT gzopen64 OF((const char *, const char *));
@@ -1720,6 +1872,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
      ZEXTERN z_off_t ZEXPORT gzoffset64 OF((gzFile));
      ZEXTERN uLong ZEXPORT adler32_combine64 OF((uLong, uLong, z_off_t));
      ZEXTERN uLong ZEXPORT crc32_combine64 OF((uLong, uLong, z_off_t));
+     ZEXTERN uLong ZEXPORT crc32_combine_gen64 OF((z_off_t));
+     ZEXTERN uLong ZEXPORT crc32c_combine64 OF((uLong, uLong, z_off_t));
 #  endif
 #else
    ZEXTERN gzFile ZEXPORT gzopen OF((const char *, const char *));
@@ -1728,12 +1882,16 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
    ZEXTERN z_off_t ZEXPORT gzoffset OF((gzFile));
    ZEXTERN uLong ZEXPORT adler32_combine OF((uLong, uLong, z_off_t));
    ZEXTERN uLong ZEXPORT crc32_combine OF((uLong, uLong, z_off_t));
+   ZEXTERN uLong ZEXPORT crc32_combine_gen OF((z_off_t));
+   ZEXTERN uLong ZEXPORT crc32c_combine OF((uLong, uLong, z_off_t));
 #endif
 
 #else /* Z_SOLO */
 
    ZEXTERN uLong ZEXPORT adler32_combine OF((uLong, uLong, z_off_t));
    ZEXTERN uLong ZEXPORT crc32_combine OF((uLong, uLong, z_off_t));
+   ZEXTERN uLong ZEXPORT crc32_combine_gen OF((z_off_t));
+   ZEXTERN uLong ZEXPORT crc32c_combine OF((uLong, uLong, z_off_t));
 
 #endif /* !Z_SOLO */
 
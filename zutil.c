@@ -6,6 +6,7 @@
 /* @(#) $Id$ */
 
 #include "zutil.h"
+#include "inffast.h"
 #ifndef Z_SOLO
 #  include "gzguts.h"
 #endif
@@ -184,6 +185,314 @@ void ZLIB_INTERNAL zmemzero(dest, len)
 }
 #endif
 
+/* ===========================================================================
+ * Run init() if this is the first z_once() for once, or wait for the thread
+ * that is running it to finish.  Z_ONCE() has already checked that init() is
+ * not known to be done.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_ATOMICS__)
+#  define TEST_AND_SET(once) atomic_flag_test_and_set(&(once)->begun)
+#  define SET_DONE(once) \
+     atomic_store_explicit(&(once)->done, 1, memory_order_release)
+#elif defined(__clang__) || (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)))
+#  define TEST_AND_SET(once) \
+     __atomic_exchange_n(&(once)->begun, 1, __ATOMIC_ACQ_REL)
+#  define SET_DONE(once) __atomic_store_n(&(once)->done, 1, __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define TEST_AND_SET(once) _InterlockedExchange(&(once)->begun, 1)
+#  define SET_DONE(once) _InterlockedExchange(&(once)->done, 1)
+#else
+   /* not atomic, but keeps the window small */
+#  define TEST_AND_SET(once) ((once)->begun ? 1 : ((once)->begun = 1, 0))
+#  define SET_DONE(once) ((once)->done = 1)
+#endif
+
+void ZLIB_INTERNAL z_once(once, init)
+    z_once_t *once;
+    void (*init) OF((void));
+{
+    if (TEST_AND_SET(once)) {
+        while (!Z_ONCE_DONE(once))
+            ;
+    }
+    else {
+        init();
+        SET_DONE(once);
+    }
+}
+
+/* ===========================================================================
+ * Checking a large buffer in pieces.  The pieces are at least PIECE_MIN bytes,
+ * so that each one is worth handing to another thread, and there are at most
+ * PIECES_MAX of them.  All of the pieces but the last are size bytes, which
+ * is a multiple of 64 to keep them cache-line aligned relative to each other.
+ */
+#define PIECE_MIN (1UL << 20)
+#define PIECES_MAX 256
+
+typedef struct pieces_s {
+    z_check_func check;         /* crc32() or adler32() */
+    const Bytef *buf;           /* whole buffer */
+    z_size_t len;               /* whole length */
+    z_size_t size;              /* length of each piece but the last */
+    unsigned count;             /* number of pieces */
+    uLong val[PIECES_MAX];      /* initial, then final check value of each */
+} pieces;
+
+local void check_piece OF((voidpf arg, unsigned index));
+
+/* ===========================================================================
+ * Check piece number index.  This is the work function given to run().
+ */
+local void check_piece(arg, index)
+    voidpf arg;
+    unsigned index;
+{
+    pieces *p = (pieces *)arg;
+    const Bytef *next;
+    z_size_t left;
+    uInt n;
+    uLong val;
+
+    if (index >= p->count)
+        return;
+    next = p->buf + (z_size_t)index * p->size;
+    left = index == p->count - 1 ? p->len - (z_size_t)index * p->size :
+                                   p->size;
+    val = p->val[index];
+    while (left) {
+        n = (uInt)-1;
+        if (n > left)
+            n = (uInt)left;
+        val = p->check(val, next, n);
+        next += n;
+        left -= n;
+    }
+    p->val[index] = val;
+}
+
+/* ========================================================================= */
+uLong ZLIB_INTERNAL z_check_parallel(check, combine, val, init, buf, len,
+                                     count, run, opaque)
+    z_check_func check;
+    z_combine_func combine;
+    uLong val;
+    uLong init;
+    const Bytef *buf;
+    z_size_t len;
+    unsigned count;
+    z_run_func run;
+    voidpf opaque;
+{
+    pieces p;
+    unsigned k;
+
+    /* decide on the pieces */
+    if (count > PIECES_MAX)
+        count = PIECES_MAX;
+    if (count > len / PIECE_MIN)
+        count = (unsigned)(len / PIECE_MIN);
+    if (count < 1)
+        count = 1;
+    p.check = check;
+    p.buf = buf;
+    p.len = len;
+    p.size = (len / count + 63) & ~(z_size_t)63;
+    p.count = count;
+    p.val[0] = val;
+    for (k = 1; k < count; k++)
+        p.val[k] = init;
+
+    /* check them, on other threads if possible */
+    if (run == Z_NULL || count == 1)
+        for (k = 0; k < count; k++)
+            check_piece(&p, k);
+    else
+        run(opaque, check_piece, &p, count);
+
+    /* merge the check values in order */
+    val = p.val[0];
+    for (k = 1; k < count; k++)
+        val = combine(val, p.val[k], (z_off64_t)(k == count - 1 ?
+                      len - (z_size_t)k * p.size : p.size));
+    return val;
+}
+
+/* ===========================================================================
+ * Checking a list of segments.  Segments shorter than GATHER_MAX bytes are
+ * copied into a buffer of GATHER bytes, which is checked when the next
+ * segment would not fit, so that a chain of short segments costs about as
+ * much as one buffer of the same total length.  Longer segments are checked
+ * where they are.
+ */
+#define GATHER 1024
+#define GATHER_MAX 256
+
+uLong ZLIB_INTERNAL z_check_iov(check, val, iov, count)
+    z_check_func check;
+    uLong val;
+    const z_iovec *iov;
+    unsigned count;
+{
+    Bytef gather[GATHER];
+    unsigned have = 0;
+    const Bytef *next;
+    z_size_t left;
+    uInt n;
+
+    for (; count; count--, iov++) {
+        next = (const Bytef *)iov->base;
+        left = iov->len;
+        if (left == 0)
+            continue;
+        if (left < GATHER_MAX) {
+            if (have + left > GATHER) {
+                val = check(val, gather, have);
+                have = 0;
+            }
+            zmemcpy(gather + have, next, (uInt)left);
+            have += (unsigned)left;
+            continue;
+        }
+        if (have) {
+            val = check(val, gather, have);
+            have = 0;
+        }
+        do {
+            n = (uInt)-1;
+            if (n > left)
+                n = (uInt)left;
+            val = check(val, next, n);
+            next += n;
+            left -= n;
+        } while (left);
+    }
+    if (have)
+        val = check(val, gather, have);
+    return val;
+}
+
+/* ===========================================================================
+ * The hot kernels, starting with the portable ones.
+ */
+z_dispatch ZLIB_INTERNAL z_kernels = {
+    crc32_generic,
+    crc32c_generic,
+    adler32_generic,
+    longest_match,
+    inflate_fast,
+    slide_hash_generic
+};
+
+#ifdef Z_X86_SIMD
+
+#ifdef _MSC_VER
+#  include <intrin.h>
+#else
+#  include <cpuid.h>
+#endif
+
+local unsigned cpu_features;
+local z_once_t cpu_once = Z_ONCE_INIT;
+
+z_once_t ZLIB_INTERNAL z_kernels_once = Z_ONCE_INIT;
+
+local void cpu_probe OF((void));
+
+/* ===========================================================================
+ * Ask the processor which of the instruction set extensions used by the
+ * zlib kernels it supports, and save that in cpu_features.  AVX2 is only
+ * reported if the operating system also saves the ymm registers on a context
+ * switch.
+ */
+local void cpu_probe()
+{
+    unsigned ebx, ecx, edx, max, xcr0;
+    unsigned features = 0;
+#ifdef _MSC_VER
+    int regs[4];
+#else
+    unsigned eax;
+#endif
+
+#ifdef _MSC_VER
+    __cpuid(regs, 0);
+    max = (unsigned)regs[0];
+    __cpuid(regs, 1);
+    ecx = (unsigned)regs[2];
+    edx = (unsigned)regs[3];
+#else
+    max = __get_cpuid_max(0, Z_NULL);
+    if (max < 1)
+        return;
+    __cpuid(1, eax, ebx, ecx, edx);
+#endif
+    if (edx & (1U << 26)) features |= Z_CPU_SSE2;
+    if (ecx & (1U << 9))  features |= Z_CPU_SSSE3;
+    if (ecx & (1U << 19)) features |= Z_CPU_SSE41;
+    if (ecx & (1U << 20)) features |= Z_CPU_SSE42;
+    if (ecx & (1U << 1))  features |= Z_CPU_PCLMUL;
+
+    /* AVX2 needs OSXSAVE and AVX, the xmm and ymm state enabled in XCR0, and
+       the AVX2 bit from leaf 7 */
+    if (max >= 7 && (ecx & (1U << 27)) && (ecx & (1U << 28))) {
+#ifdef _MSC_VER
+        xcr0 = (unsigned)_xgetbv(0);
+        __cpuidex(regs, 7, 0);
+        ebx = (unsigned)regs[1];
+#else
+        __asm__ __volatile__ ("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+#endif
+        if ((xcr0 & 6) == 6 && (ebx & (1U << 5)))
+            features |= Z_CPU_AVX2;
+    }
+    cpu_features = features;
+}
+
+/* ===========================================================================
+ * Return the Z_CPU_* flags for this processor.  The processor is probed on the
+ * first call only.
+ */
+unsigned ZLIB_INTERNAL z_cpu_features()
+{
+    Z_ONCE(&cpu_once, cpu_probe);
+    return cpu_features;
+}
+
+/* ===========================================================================
+ * Point z_kernels at the best implementations for this processor.  This is
+ * run once, by Z_KERNELS_INIT().
+ */
+void ZLIB_INTERNAL z_kernels_select()
+{
+    unsigned features = z_cpu_features();
+
+    if ((features & Z_CPU_PCLMUL) && (features & Z_CPU_SSE2))
+        z_kernels.crc32 = crc32_pclmul;
+    if (features & Z_CPU_SSE42)
+        z_kernels.crc32c = crc32c_sse42;
+    if (features & Z_CPU_AVX2)
+        z_kernels.adler32 = adler32_avx2;
+    else if (features & Z_CPU_SSSE3)
+        z_kernels.adler32 = adler32_ssse3;
+    if (features & Z_CPU_AVX2)
+        z_kernels.slide_hash = slide_hash_avx2;
+    else if (features & Z_CPU_SSE2)
+        z_kernels.slide_hash = slide_hash_sse2;
+#if !defined(FASTEST) && !defined(ASMV)
+    if (features & Z_CPU_AVX2)
+        z_kernels.longest_match = longest_match_avx2;
+    else if (features & Z_CPU_SSE2)
+        z_kernels.longest_match = longest_match_sse2;
+#endif
+}
+
+#endif /* Z_X86_SIMD */
+
 #ifndef Z_SOLO
 
 #ifdef SYS16BIT
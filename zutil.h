@@ -172,6 +172,8 @@ extern z_const char * const z_errmsg[10]; /* indexed by 2-zlib_error */
     (!defined(_LARGEFILE64_SOURCE) || _LFS64_LARGEFILE-0 == 0)
     ZEXTERN uLong ZEXPORT adler32_combine64 OF((uLong, uLong, z_off_t));
     ZEXTERN uLong ZEXPORT crc32_combine64 OF((uLong, uLong, z_off_t));
+    ZEXTERN uLong ZEXPORT crc32_combine_gen64 OF((z_off_t));
+    ZEXTERN uLong ZEXPORT crc32c_combine64 OF((uLong, uLong, z_off_t));
 #endif
 
         /* common defaults */
@@ -250,4 +252,158 @@ extern z_const char * const z_errmsg[10]; /* indexed by 2-zlib_error */
 #define ZSWAP32(q) ((((q) >> 24) & 0xff) + (((q) >> 8) & 0xff00) + \
                     (((q) & 0xff00) << 8) + (((q) & 0xff) << 24))
 
+/* One-time initialization.  A z_once_t starts out as Z_ONCE_INIT, and
+ * Z_ONCE(once, init) calls init() exactly once for it, however many threads
+ * get there at the same time.  Threads that arrive while init() is running
+ * wait for it to finish.  Once it has, Z_ONCE() is a single load and takes
+ * no lock.  This needs C11 atomics, the gcc __atomic builtins, or the Visual
+ * C interlocked functions.  With none of those, the first call must not be
+ * made from more than one thread at a time.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_ATOMICS__)
+#  include <stdatomic.h>
+   typedef struct z_once_s {
+       atomic_flag begun;
+       atomic_int done;
+   } z_once_t;
+#  define Z_ONCE_INIT {ATOMIC_FLAG_INIT, 0}
+#  define Z_ONCE_DONE(once) \
+     atomic_load_explicit(&(once)->done, memory_order_acquire)
+#else
+   typedef struct z_once_s {
+       volatile long begun;
+       volatile long done;
+   } z_once_t;
+#  define Z_ONCE_INIT {0, 0}
+#  if defined(__clang__) || (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)))
+#    define Z_ONCE_DONE(once) __atomic_load_n(&(once)->done, __ATOMIC_ACQUIRE)
+#  else
+#    define Z_ONCE_DONE(once) ((once)->done)
+#  endif
+#endif
+void ZLIB_INTERNAL z_once OF((z_once_t *once, void (*init)(void)));
+#define Z_ONCE(once, init) \
+    do { if (!Z_ONCE_DONE(once)) z_once(once, init); } while (0)
+
+/* Split buf[0..len-1] into pieces, apply check() to each through run(), and
+ * merge the results with combine().  The first piece starts from val, and the
+ * others from init.  buf is not NULL.  This is crc32_parallel() and
+ * adler32_parallel().
+ */
+typedef uLong (*z_check_func) OF((uLong val, const Bytef *buf, uInt len));
+typedef uLong (*z_combine_func) OF((uLong val1, uLong val2, z_off64_t len2));
+uLong ZLIB_INTERNAL z_check_parallel OF((z_check_func check,
+                                         z_combine_func combine, uLong val,
+                                         uLong init, const Bytef *buf,
+                                         z_size_t len, unsigned count,
+                                         z_run_func run, voidpf opaque));
+
+/* Apply check() to the segments iov[0..count-1] in order.  iov is not NULL.
+ * This is crc32_iov() and adler32_iov().
+ */
+uLong ZLIB_INTERNAL z_check_iov OF((z_check_func check, uLong val,
+                                    const z_iovec *iov, unsigned count));
+
+/* Processor-specific code.  On x86 and x86-64, kernels that use instruction
+ * set extensions are compiled in with a per-function target attribute (gcc
+ * and clang) or unconditionally (Visual C), so that the library as a whole
+ * still runs on any processor.  The kernels are only called after the
+ * processor has been checked at run time with z_cpu_features().  Compile with
+ * -DNO_SIMD to leave them out.
+ */
+#if !defined(NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || \
+                          defined(__i386__) || defined(_M_IX86))
+#  if defined(__clang__) || (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#    define Z_X86_SIMD
+#    define Z_TARGET(isa) __attribute__((target(isa)))
+#  elif defined(_MSC_VER) && _MSC_VER >= 1600
+#    define Z_X86_SIMD
+#    define Z_TARGET(isa)
+#  endif
+#endif
+
+#ifdef Z_X86_SIMD
+#  define Z_CPU_SSE2    0x01
+#  define Z_CPU_SSSE3   0x02
+#  define Z_CPU_SSE41   0x04
+#  define Z_CPU_SSE42   0x08
+#  define Z_CPU_PCLMUL  0x10
+#  define Z_CPU_AVX2    0x20
+   unsigned ZLIB_INTERNAL z_cpu_features OF((void));
+#endif
+
+/* The hot kernels are called through z_kernels, so that a single library can
+ * use the best implementation for the processor it finds itself on.  The
+ * table starts out with the portable functions.  Z_KERNELS_INIT() must be
+ * used before the first call through it, which crc32(), adler32(), and the
+ * *Init* functions do.  It makes the choice for the processor, once.
+ */
+typedef struct z_dispatch_s {
+    unsigned long (*crc32) OF((unsigned long crc,
+                               const unsigned char FAR *buf, unsigned len));
+    unsigned long (*crc32c) OF((unsigned long crc,
+                                const unsigned char FAR *buf, unsigned len));
+    uLong (*adler32) OF((uLong adler, const Bytef *buf, uInt len));
+    uInt (*longest_match) OF((struct internal_state FAR *s,
+                              unsigned cur_match));
+    void (*inflate_fast) OF((z_streamp strm, unsigned start));
+    void (*slide_hash) OF((struct internal_state FAR *s));
+} z_dispatch;
+
+extern z_dispatch ZLIB_INTERNAL z_kernels;
+#ifdef Z_X86_SIMD
+   extern z_once_t ZLIB_INTERNAL z_kernels_once;
+   void ZLIB_INTERNAL z_kernels_select OF((void));
+#  define Z_KERNELS_INIT() Z_ONCE(&z_kernels_once, z_kernels_select)
+#else
+#  define Z_KERNELS_INIT()
+#endif
+
+/* Copy len bytes from src to dst, and return check updated with their CRC-32
+ * or Adler-32.  The bytes are copied and checked Z_COPY_BLOCK at a time, so
+ * that each block is checked while it is still in the first-level cache.
+ */
+#define Z_COPY_BLOCK 4096
+uLong ZLIB_INTERNAL copy_with_crc32 OF((uLong crc, Bytef *dst,
+                                        const Bytef *src, uInt len));
+uLong ZLIB_INTERNAL copy_with_adler32 OF((uLong adler, Bytef *dst,
+                                          const Bytef *src, uInt len));
+
+   /* the implementations that z_kernels chooses from */
+unsigned long ZLIB_INTERNAL crc32_generic OF((unsigned long crc,
+                                const unsigned char FAR *buf, unsigned len));
+unsigned long ZLIB_INTERNAL crc32c_generic OF((unsigned long crc,
+                                const unsigned char FAR *buf, unsigned len));
+uLong ZLIB_INTERNAL adler32_generic OF((uLong adler, const Bytef *buf,
+                                        uInt len));
+uInt ZLIB_INTERNAL longest_match OF((struct internal_state FAR *s,
+                                     unsigned cur_match));
+void ZLIB_INTERNAL slide_hash_generic OF((struct internal_state FAR *s));
+#ifdef Z_X86_SIMD
+unsigned long ZLIB_INTERNAL crc32_pclmul OF((unsigned long crc,
+                                const unsigned char FAR *buf, unsigned len));
+unsigned long ZLIB_INTERNAL crc32c_sse42 OF((unsigned long crc,
+                                const unsigned char FAR *buf, unsigned len))
+                                Z_TARGET("sse4.2");
+uLong ZLIB_INTERNAL adler32_ssse3 OF((uLong adler, const Bytef *buf,
+                                      uInt len)) Z_TARGET("ssse3");
+uLong ZLIB_INTERNAL adler32_avx2 OF((uLong adler, const Bytef *buf,
+                                     uInt len)) Z_TARGET("avx2");
+void ZLIB_INTERNAL slide_hash_sse2 OF((struct internal_state FAR *s))
+                                      Z_TARGET("sse2");
+void ZLIB_INTERNAL slide_hash_avx2 OF((struct internal_state FAR *s))
+                                      Z_TARGET("avx2");
+#  if !defined(FASTEST) && !defined(ASMV)
+uInt ZLIB_INTERNAL longest_match_sse2 OF((struct internal_state FAR *s,
+                                          unsigned cur_match))
+                                          Z_TARGET("sse2");
+uInt ZLIB_INTERNAL longest_match_avx2 OF((struct internal_state FAR *s,
+                                          unsigned cur_match))
+                                          Z_TARGET("avx2");
+#  endif
+#endif
+
 #endif /* ZUTIL_H */